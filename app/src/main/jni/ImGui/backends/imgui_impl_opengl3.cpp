@@ -14,6 +14,12 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Read index data from ImDrawList::IdxChunks[] + IdxBuffer[], so merging columns/tables channels doesn't copy indices. Enable ImGuiBackendFlags_RendererHasIdxChunks.
+//  2026-10-18: OpenGL: Render the font texture through a distance field path of the fragment shader when the atlas is built with ImFontAtlasFlags_SignedDistanceField. Enable ImGuiBackendFlags_RendererHasSdfFonts.
+//  2026-10-18: OpenGL: Upload font atlas texture updates (io.Fonts->TexDirtyRects[]) and re-create the texture when the atlas grows. Enable ImGuiBackendFlags_RendererHasTexUpdates.
+//  2026-10-18: OpenGL: Pack all draw lists into a single vertex/index buffer upload per frame. Stream through glMapBufferRange() into a fenced ring of buffer regions on GL 3.2+/ES 3.0+. Added ImGui_ImplOpenGL3_GetFrameStats().
+//  2026-10-18: OpenGL: Merge consecutive draw commands, including across draw lists, sharing the same texture and either the same scissor rectangle or lying inside it. Skip redundant glBindTexture()/glScissor() calls.
+//  2026-10-18: OpenGL: Added ImGui_ImplOpenGL3_SetStateFlags() to select the GL state saved/restored by ImGui_ImplOpenGL3_RenderDrawData(), or restore it from a cache instead of querying it every frame.
 //  2021-12-15: OpenGL: Using buffer orphaning + glBufferSubData(), seems to fix leaks with multi-viewports with some Intel HD drivers.
 //  2021-08-23: OpenGL: Fixed ES 3.0 shader ("#version 300 es") use normal precision floats to avoid wobbly rendering at HD resolutions.
 //  2021-08-19: OpenGL: Embed and use our own minimal GL loader (imgui_impl_opengl3_loader.h), removing requirement and support for third-party loader.
@@ -171,29 +177,90 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
 #endif
 
+// Desktop GL 3.0+ and GL ES 3.0+ have glMapBufferRange(), Desktop GL 3.2+ and GL ES 3.0+ have fences (glFenceSync() etc.)
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_DISABLE_BUFFER_MAPPING)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_MAPPING
+#endif
+
 // Desktop GL use extension detection
 #if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3)
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
 #endif
 
+// Vertex/index buffers streaming
+// - All draw lists of a frame are packed into a single vertex buffer and a single index buffer, uploaded once per frame.
+//   Draw commands then address their data with offsets: glDrawElementsBaseVertex() when available, else vertex attributes are re-pointed for each draw list.
+// - With buffer mapping (GL 3.2+, GL ES 3.0+), buffers are split into IMGUI_IMPL_OPENGL_BUFFER_FRAMES regions used as a ring.
+//   Each frame maps its region with GL_MAP_UNSYNCHRONIZED_BIT, and a fence protects the region until the GPU is done reading it.
+// - Otherwise draw lists are packed into a CPU staging buffer and uploaded with one glBufferSubData() call per buffer.
+#ifndef IMGUI_IMPL_OPENGL_BUFFER_FRAMES
+#define IMGUI_IMPL_OPENGL_BUFFER_FRAMES     3
+#endif
+
+// GL state saved before rendering and restored after (see ImGui_ImplOpenGL3_SetStateFlags())
+struct ImGui_ImplOpenGL3_State
+{
+    GLenum          ActiveTexture;
+    GLuint          Program;
+    GLuint          Texture;
+    GLuint          Sampler;
+    GLuint          VertexArrayObject;
+    GLuint          ArrayBuffer;
+    GLenum          BlendSrcRgb, BlendDstRgb, BlendSrcAlpha, BlendDstAlpha;
+    GLenum          BlendEquationRgb, BlendEquationAlpha;
+    GLboolean       EnableBlend, EnableCullFace, EnableDepthTest, EnableStencilTest, EnableScissorTest, EnablePrimitiveRestart;
+    GLint           PolygonMode[2];
+    GLint           Viewport[4];
+    GLint           ScissorBox[4];
+};
+
+// Draw command or run of merged draw commands (see ImGui_ImplOpenGL3_RenderDrawData())
+struct ImGui_ImplOpenGL3_DrawBatch
+{
+    const ImDrawList*   CmdList;            // Draw list owning Cmd
+    const ImDrawCmd*    Cmd;                // User callback command, NULL for a draw
+    ImTextureID         TexId;
+    GLint               Scissor[4];         // Scissor rectangle in framebuffer space (Y pointing up). Whole framebuffer when NeedScissor is false.
+    bool                NeedScissor;        // False when all vertices were found inside the clipping rectangle
+    unsigned int        VtxOffset;          // Vertex base, relative to the region of our buffers used by the frame
+    unsigned int        IdxOffset;          // First index, relative to the region of our buffers used by the frame
+    unsigned int        ElemCount;
+};
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
     GLuint          GlVersion;               // Extracted at runtime using GL_MAJOR_VERSION, GL_MINOR_VERSION queries (e.g. 320 for GL 3.2)
     char            GlslVersionString[32];   // Specified by user or detected based on compile time GL settings.
     GLuint          FontTexture;
+    int             FontTextureWidth, FontTextureHeight;
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
+    GLint           AttribLocationSdfEnabled;
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
     unsigned int    VboHandle, ElementsHandle;
-    GLsizeiptr      VertexBufferSize;
-    GLsizeiptr      IndexBufferSize;
+    int             VertexBufferSize;        // Capacity of one region of the vertex buffer, in vertices
+    int             IndexBufferSize;         // Capacity of one region of the index buffer, in indices
+    int             BufferFrame;             // Region of the buffers used by the last frame
+    char*           StagingBuffer;           // Vertices and indices of all draw lists packed for a single upload, when not using buffer mapping
+    size_t          StagingBufferSize;
     bool            HasClipOrigin;
-
-    ImGui_ImplOpenGL3_Data() { memset(this, 0, sizeof(*this)); }
+    bool            UseBufferMapping;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_MAPPING
+    GLsync          BufferFences[IMGUI_IMPL_OPENGL_BUFFER_FRAMES];
+#endif
+    ImGui_ImplOpenGL3_FrameStats FrameStats;
+    ImVector<ImGui_ImplOpenGL3_DrawBatch> Batches;
+    int             StateRestoreFlags;       // ImGui_ImplOpenGL3_StateFlags_: state saved and restored by ImGui_ImplOpenGL3_RenderDrawData()
+    int             StateCachedFlags;        // ImGui_ImplOpenGL3_StateFlags_: part of StateRestoreFlags restored from StateCache
+    int             StateCacheValidFlags;    // ImGui_ImplOpenGL3_StateFlags_: part of StateCache queried since the last invalidation
+    int             StateQueriesAll;         // glGet*()/glIsEnabled() calls needed to save all state
+    ImGui_ImplOpenGL3_State StateCache;
+
+    ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
 
 // Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
@@ -203,6 +270,9 @@ static ImGui_ImplOpenGL3_Data* ImGui_ImplOpenGL3_GetBackendData()
     return ImGui::GetCurrentContext() ? (ImGui_ImplOpenGL3_Data*)ImGui::GetIO().BackendRendererUserData : NULL;
 }
 
+// Forward Declarations
+static int ImGui_ImplOpenGL3_BackupState(ImGui_ImplOpenGL3_State* state, int flags);
+
 // Functions
 bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 {
@@ -244,6 +314,9 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (bd->GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;     // We can upload io.Fonts->TexDirtyRects[], allowing for ImFontAtlasFlags_DynamicGlyphs.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfFonts;       // We can render a distance field font texture, allowing for ImFontAtlasFlags_SignedDistanceField.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasIdxChunks;      // We can read ImDrawList::IdxChunks[], allowing ImDrawListSplitter::Merge() to link index buffers instead of copying them.
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to NULL if unsure.
@@ -268,6 +341,18 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     GLint current_texture;
     glGetIntegerv(GL_TEXTURE_BINDING_2D, &current_texture);
 
+    // Stream vertices/indices through glMapBufferRange() when fences are also available
+#if defined(IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_MAPPING) && defined(IMGUI_IMPL_OPENGL_ES3)
+    bd->UseBufferMapping = (bd->GlVersion >= 300);
+#elif defined(IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_MAPPING)
+    bd->UseBufferMapping = (bd->GlVersion >= 320);
+#endif
+
+    // Save and restore all state by default
+    ImGui_ImplOpenGL3_State state;
+    bd->StateRestoreFlags = ImGui_ImplOpenGL3_StateFlags_All;
+    bd->StateQueriesAll = ImGui_ImplOpenGL3_BackupState(&state, ImGui_ImplOpenGL3_StateFlags_All);
+
     // Detect extensions we support
     bd->HasClipOrigin = (bd->GlVersion >= 450);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
@@ -305,6 +390,22 @@ void    ImGui_ImplOpenGL3_NewFrame()
         ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
+const ImGui_ImplOpenGL3_FrameStats* ImGui_ImplOpenGL3_GetFrameStats()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplOpenGL3_Init()?");
+    return &bd->FrameStats;
+}
+
+// Point vertex attributes at the ImDrawVert data starting at 'vtx_offset' bytes in the vertex buffer
+static void ImGui_ImplOpenGL3_SetupVertexAttribs(size_t vtx_offset)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)(vtx_offset + IM_OFFSETOF(ImDrawVert, pos)));
+    glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)(vtx_offset + IM_OFFSETOF(ImDrawVert, uv)));
+    glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)(vtx_offset + IM_OFFSETOF(ImDrawVert, col)));
+}
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
@@ -356,6 +457,7 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    glUniform1f(bd->AttribLocationSdfEnabled, 0.0f);
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->GlVersion >= 330)
@@ -373,9 +475,315 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glEnableVertexAttribArray(bd->AttribLocationVtxPos);
     glEnableVertexAttribArray(bd->AttribLocationVtxUV);
     glEnableVertexAttribArray(bd->AttribLocationVtxColor);
-    glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
-    glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
-    glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
+    ImGui_ImplOpenGL3_SetupVertexAttribs(0);
+}
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_MAPPING
+static void ImGui_ImplOpenGL3_DestroyBufferFences()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    for (int n = 0; n < IMGUI_IMPL_OPENGL_BUFFER_FRAMES; n++)
+        if (bd->BufferFences[n])
+        {
+            glDeleteSync(bd->BufferFences[n]);
+            bd->BufferFences[n] = NULL;
+        }
+}
+#endif
+
+// Copy vertices/indices of all draw lists one after another. The index data of a draw list is IdxChunks[0] + IdxChunks[1] + ... + IdxBuffer.
+// With 'rebase_indices', indices are offset by the position of their draw list vertices, so all draw lists share a single vertex base.
+static void ImGui_ImplOpenGL3_CopyDrawLists(ImDrawData* draw_data, ImDrawVert* vtx_dst, ImDrawIdx* idx_dst, bool rebase_indices)
+{
+    unsigned int vtx_base = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        memcpy(vtx_dst, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        for (int chunk_n = 0; chunk_n <= cmd_list->IdxChunks.Size; chunk_n++)
+        {
+            const ImVector<ImDrawIdx>& idx_src = (chunk_n < cmd_list->IdxChunks.Size) ? cmd_list->IdxChunks[chunk_n] : cmd_list->IdxBuffer;
+            if (!rebase_indices || vtx_base == 0)
+                memcpy(idx_dst, idx_src.Data, (size_t)idx_src.Size * sizeof(ImDrawIdx));
+            else
+                for (int i = 0; i < idx_src.Size; i++)
+                    idx_dst[i] = (ImDrawIdx)(idx_src.Data[i] + vtx_base);
+            idx_dst += idx_src.Size;
+        }
+        vtx_dst += cmd_list->VtxBuffer.Size;
+        vtx_base += (unsigned int)cmd_list->VtxBuffer.Size;
+    }
+}
+
+// Upload vertices/indices of all draw lists into the next region of our buffers (see comments above IMGUI_IMPL_OPENGL_BUFFER_FRAMES).
+// Vertex/index buffers need to be bound. Output the position of the region, in vertices and indices.
+static void ImGui_ImplOpenGL3_UploadBuffers(ImDrawData* draw_data, bool rebase_indices, int* out_vtx_start, int* out_idx_start)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_FrameStats* stats = &bd->FrameStats;
+    const int regions_count = bd->UseBufferMapping ? IMGUI_IMPL_OPENGL_BUFFER_FRAMES : 1;
+
+    // Grow buffers. Both are reallocated (orphaning their previous storage) so all regions become free to use.
+    if (bd->VertexBufferSize < draw_data->TotalVtxCount || bd->IndexBufferSize < draw_data->TotalIdxCount)
+    {
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_MAPPING
+        ImGui_ImplOpenGL3_DestroyBufferFences();
+#endif
+        if (bd->VertexBufferSize < draw_data->TotalVtxCount)
+            bd->VertexBufferSize = draw_data->TotalVtxCount + 5000;
+        if (bd->IndexBufferSize < draw_data->TotalIdxCount)
+            bd->IndexBufferSize = draw_data->TotalIdxCount + 10000;
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)bd->VertexBufferSize * regions_count * (int)sizeof(ImDrawVert), NULL, GL_STREAM_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)bd->IndexBufferSize * regions_count * (int)sizeof(ImDrawIdx), NULL, GL_STREAM_DRAW);
+        stats->UploadCalls += 2;
+    }
+
+    bd->BufferFrame = (bd->BufferFrame + 1) % regions_count;
+    *out_vtx_start = bd->BufferFrame * bd->VertexBufferSize;
+    *out_idx_start = bd->BufferFrame * bd->IndexBufferSize;
+    const GLintptr vtx_offset = (GLintptr)*out_vtx_start * (int)sizeof(ImDrawVert);
+    const GLintptr idx_offset = (GLintptr)*out_idx_start * (int)sizeof(ImDrawIdx);
+    const GLsizeiptr vtx_size = (GLsizeiptr)draw_data->TotalVtxCount * (int)sizeof(ImDrawVert);
+    const GLsizeiptr idx_size = (GLsizeiptr)draw_data->TotalIdxCount * (int)sizeof(ImDrawIdx);
+    if (vtx_size == 0 || idx_size == 0)
+        return;
+    stats->UploadBytes += (int)(vtx_size + idx_size);
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_MAPPING
+    if (bd->UseBufferMapping)
+    {
+        // Wait until the GPU is done reading the region we are about to overwrite (normally signaled a couple of frames ago)
+        if (GLsync fence = bd->BufferFences[bd->BufferFrame])
+        {
+            while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, (GLuint64)1000000000) == GL_TIMEOUT_EXPIRED) {}
+            glDeleteSync(fence);
+            bd->BufferFences[bd->BufferFrame] = NULL;
+        }
+
+        const GLbitfield map_flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+        ImDrawVert* vtx_dst = (ImDrawVert*)glMapBufferRange(GL_ARRAY_BUFFER, vtx_offset, vtx_size, map_flags);
+        ImDrawIdx* idx_dst = (ImDrawIdx*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, idx_offset, idx_size, map_flags);
+        if (vtx_dst != NULL && idx_dst != NULL)
+            ImGui_ImplOpenGL3_CopyDrawLists(draw_data, vtx_dst, idx_dst, rebase_indices);
+        bool mapped = (vtx_dst != NULL && idx_dst != NULL);
+        if (vtx_dst != NULL && !glUnmapBuffer(GL_ARRAY_BUFFER))
+            mapped = false;
+        if (idx_dst != NULL && !glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER))
+            mapped = false;
+        stats->UploadCalls += 2;
+        if (mapped)
+            return;
+        // Mapping failed or contents were lost: upload with glBufferSubData() instead
+    }
+#endif
+
+    // Pack all draw lists in our staging buffer, unless there is only one list with contiguous indices
+    const void* vtx_src = draw_data->CmdListsCount > 0 ? draw_data->CmdLists[0]->VtxBuffer.Data : NULL;
+    const void* idx_src = draw_data->CmdListsCount > 0 ? draw_data->CmdLists[0]->IdxBuffer.Data : NULL;
+    if (draw_data->CmdListsCount > 1 || (draw_data->CmdListsCount == 1 && draw_data->CmdLists[0]->IdxChunks.Size > 0))
+    {
+        const size_t staging_size = (size_t)(vtx_size + idx_size);
+        if (bd->StagingBufferSize < staging_size)
+        {
+            IM_FREE(bd->StagingBuffer);
+            bd->StagingBufferSize = staging_size + staging_size / 2;
+            bd->StagingBuffer = (char*)IM_ALLOC(bd->StagingBufferSize);
+        }
+        ImDrawVert* vtx_dst = (ImDrawVert*)bd->StagingBuffer;
+        ImDrawIdx* idx_dst = (ImDrawIdx*)(bd->StagingBuffer + vtx_size);
+        ImGui_ImplOpenGL3_CopyDrawLists(draw_data, vtx_dst, idx_dst, rebase_indices);
+        vtx_src = vtx_dst;
+        idx_src = idx_dst;
+    }
+    glBufferSubData(GL_ARRAY_BUFFER, vtx_offset, vtx_size, (const GLvoid*)vtx_src);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, idx_offset, idx_size, (const GLvoid*)idx_src);
+    stats->UploadCalls += 2;
+}
+
+// Return true if all vertices of a draw command, projected into framebuffer space (Y pointing down), lie inside a rectangle.
+// Pixels covered by its triangles are then all inside the rectangle, and the command can be drawn with a larger scissor rectangle.
+// The indices of a command may span several buffers of IdxChunks[] + IdxBuffer.
+static bool ImGui_ImplOpenGL3_IsCmdInsideRect(const ImDrawList* cmd_list, const ImDrawCmd* pcmd, const ImVec2& clip_off, const ImVec2& clip_scale, const ImVec2& rect_min, const ImVec2& rect_max)
+{
+    const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+    unsigned int idx_n = pcmd->IdxOffset;
+    const unsigned int idx_end = pcmd->IdxOffset + pcmd->ElemCount;
+    unsigned int buffer_start = 0;
+    for (int chunk_n = 0; chunk_n <= cmd_list->IdxChunks.Size && idx_n < idx_end; chunk_n++)
+    {
+        const ImVector<ImDrawIdx>& idx_buffer = (chunk_n < cmd_list->IdxChunks.Size) ? cmd_list->IdxChunks[chunk_n] : cmd_list->IdxBuffer;
+        const unsigned int buffer_end = buffer_start + (unsigned int)idx_buffer.Size;
+        for (; idx_n < idx_end && idx_n < buffer_end; idx_n++)
+        {
+            const ImVec2& pos = vtx_buffer[idx_buffer.Data[idx_n - buffer_start]].pos;
+            const float x = (pos.x - clip_off.x) * clip_scale.x;
+            const float y = (pos.y - clip_off.y) * clip_scale.y;
+            if (x < rect_min.x || x > rect_max.x || y < rect_min.y || y > rect_max.y)
+                return false;
+        }
+        buffer_start = buffer_end;
+    }
+    return true;
+}
+
+void    ImGui_ImplOpenGL3_SetStateFlags(int restore_flags, int cached_flags)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplOpenGL3_Init()?");
+    IM_ASSERT((cached_flags & ~restore_flags) == 0 && "Cached state must also be restored!");
+    bd->StateRestoreFlags = restore_flags;
+    bd->StateCachedFlags = cached_flags;
+    bd->StateCacheValidFlags = 0;
+}
+
+void    ImGui_ImplOpenGL3_InvalidateStateCache()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplOpenGL3_Init()?");
+    bd->StateCacheValidFlags = 0;
+}
+
+// Query the GL state selected by 'flags' (ImGui_ImplOpenGL3_StateFlags_). Return the number of glGet*()/glIsEnabled() calls made.
+// Texture and sampler bindings are those of the active texture unit.
+static int ImGui_ImplOpenGL3_BackupState(ImGui_ImplOpenGL3_State* state, int flags)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    int queries = 0;
+    if (flags & ImGui_ImplOpenGL3_StateFlags_ActiveTexture) { glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&state->ActiveTexture); queries++; }
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Program)       { glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&state->Program); queries++; }
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Texture)       { glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&state->Texture); queries++; }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Sampler)       { if (bd->GlVersion >= 330) { glGetIntegerv(GL_SAMPLER_BINDING, (GLint*)&state->Sampler); queries++; } else { state->Sampler = 0; } }
+#endif
+    if (flags & ImGui_ImplOpenGL3_StateFlags_ArrayBuffer)   { glGetIntegerv(GL_ARRAY_BUFFER_BINDING, (GLint*)&state->ArrayBuffer); queries++; }
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    if (flags & ImGui_ImplOpenGL3_StateFlags_VertexArray)   { glGetIntegerv(GL_VERTEX_ARRAY_BINDING, (GLint*)&state->VertexArrayObject); queries++; }
+#endif
+#ifdef IMGUI_IMPL_HAS_POLYGON_MODE
+    if (flags & ImGui_ImplOpenGL3_StateFlags_PolygonMode)   { glGetIntegerv(GL_POLYGON_MODE, state->PolygonMode); queries++; }
+#endif
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Viewport)      { glGetIntegerv(GL_VIEWPORT, state->Viewport); queries++; }
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Scissor)       { glGetIntegerv(GL_SCISSOR_BOX, state->ScissorBox); queries++; }
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Blend)
+    {
+        glGetIntegerv(GL_BLEND_SRC_RGB, (GLint*)&state->BlendSrcRgb);
+        glGetIntegerv(GL_BLEND_DST_RGB, (GLint*)&state->BlendDstRgb);
+        glGetIntegerv(GL_BLEND_SRC_ALPHA, (GLint*)&state->BlendSrcAlpha);
+        glGetIntegerv(GL_BLEND_DST_ALPHA, (GLint*)&state->BlendDstAlpha);
+        glGetIntegerv(GL_BLEND_EQUATION_RGB, (GLint*)&state->BlendEquationRgb);
+        glGetIntegerv(GL_BLEND_EQUATION_ALPHA, (GLint*)&state->BlendEquationAlpha);
+        queries += 6;
+    }
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Capabilities)
+    {
+        state->EnableBlend = glIsEnabled(GL_BLEND);
+        state->EnableCullFace = glIsEnabled(GL_CULL_FACE);
+        state->EnableDepthTest = glIsEnabled(GL_DEPTH_TEST);
+        state->EnableStencilTest = glIsEnabled(GL_STENCIL_TEST);
+        state->EnableScissorTest = glIsEnabled(GL_SCISSOR_TEST);
+        queries += 5;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
+        if (bd->GlVersion >= 310) { state->EnablePrimitiveRestart = glIsEnabled(GL_PRIMITIVE_RESTART); queries++; } else { state->EnablePrimitiveRestart = GL_FALSE; }
+#endif
+    }
+    (void)bd; // Not all compilation paths use this
+    return queries;
+}
+
+// Restore the GL state selected by 'flags' (ImGui_ImplOpenGL3_StateFlags_).
+static void ImGui_ImplOpenGL3_RestoreState(const ImGui_ImplOpenGL3_State* state, int flags)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Program)
+        glUseProgram(state->Program);
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Texture)
+        glBindTexture(GL_TEXTURE_2D, state->Texture);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+    if ((flags & ImGui_ImplOpenGL3_StateFlags_Sampler) && bd->GlVersion >= 330)
+        glBindSampler(0, state->Sampler);
+#endif
+    if (flags & ImGui_ImplOpenGL3_StateFlags_ActiveTexture)
+        glActiveTexture(state->ActiveTexture);
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    if (flags & ImGui_ImplOpenGL3_StateFlags_VertexArray)
+        glBindVertexArray(state->VertexArrayObject);
+#endif
+    if (flags & ImGui_ImplOpenGL3_StateFlags_ArrayBuffer)
+        glBindBuffer(GL_ARRAY_BUFFER, state->ArrayBuffer);
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Blend)
+    {
+        glBlendEquationSeparate(state->BlendEquationRgb, state->BlendEquationAlpha);
+        glBlendFuncSeparate(state->BlendSrcRgb, state->BlendDstRgb, state->BlendSrcAlpha, state->BlendDstAlpha);
+    }
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Capabilities)
+    {
+        if (state->EnableBlend) glEnable(GL_BLEND); else glDisable(GL_BLEND);
+        if (state->EnableCullFace) glEnable(GL_CULL_FACE); else glDisable(GL_CULL_FACE);
+        if (state->EnableDepthTest) glEnable(GL_DEPTH_TEST); else glDisable(GL_DEPTH_TEST);
+        if (state->EnableStencilTest) glEnable(GL_STENCIL_TEST); else glDisable(GL_STENCIL_TEST);
+        if (state->EnableScissorTest) glEnable(GL_SCISSOR_TEST); else glDisable(GL_SCISSOR_TEST);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
+        if (bd->GlVersion >= 310) { if (state->EnablePrimitiveRestart) glEnable(GL_PRIMITIVE_RESTART); else glDisable(GL_PRIMITIVE_RESTART); }
+#endif
+    }
+#ifdef IMGUI_IMPL_HAS_POLYGON_MODE
+    if (flags & ImGui_ImplOpenGL3_StateFlags_PolygonMode)
+        glPolygonMode(GL_FRONT_AND_BACK, (GLenum)state->PolygonMode[0]);
+#endif
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Viewport)
+        glViewport(state->Viewport[0], state->Viewport[1], (GLsizei)state->Viewport[2], (GLsizei)state->Viewport[3]);
+    if (flags & ImGui_ImplOpenGL3_StateFlags_Scissor)
+        glScissor(state->ScissorBox[0], state->ScissorBox[1], (GLsizei)state->ScissorBox[2], (GLsizei)state->ScissorBox[3]);
+    (void)bd; // Not all compilation paths use this
+}
+
+// Upload parts of the font atlas updated since the last frame (io.Fonts->TexDirtyRects[]), or the whole atlas if it was resized.
+// Return true when the font texture was bound to do so.
+static bool ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImFontAtlas* atlas = io.Fonts;
+    const bool resized = (atlas->TexWidth != bd->FontTextureWidth || atlas->TexHeight != bd->FontTextureHeight);
+    if (!resized && atlas->TexDirtyRects.Size == 0)
+        return false;
+    if (bd->FontTexture == 0 || atlas->TexPixelsRGBA32 == NULL)
+    {
+        atlas->TexDirtyRects.resize(0);
+        return false;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, bd->FontTexture);
+    if (resized)
+    {
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, atlas->TexWidth, atlas->TexHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32);
+        bd->FontTextureWidth = atlas->TexWidth;
+        bd->FontTextureHeight = atlas->TexHeight;
+    }
+    else
+    {
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, atlas->TexWidth);
+#endif
+        for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+        {
+            const ImFontAtlasDirtyRect& r = atlas->TexDirtyRects[n];
+#ifdef GL_UNPACK_ROW_LENGTH
+            glTexSubImage2D(GL_TEXTURE_2D, 0, r.X, r.Y, r.Width, r.Height, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + r.X + r.Y * atlas->TexWidth);
+#else
+            // Without GL_UNPACK_ROW_LENGTH we can only upload full rows
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, r.Y, atlas->TexWidth, r.Height, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + r.Y * atlas->TexWidth);
+#endif
+        }
+#ifdef GL_UNPACK_ROW_LENGTH
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+    }
+    atlas->TexDirtyRects.resize(0);
+    return true;
 }
 
 // OpenGL3 Render function.
@@ -391,37 +799,22 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
-    // Backup GL state
-    GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
+    ImGui_ImplOpenGL3_FrameStats* stats = &bd->FrameStats;
+    *stats = ImGui_ImplOpenGL3_FrameStats();
+
+    // Backup GL state, except state restored from our cache. Texture bindings are queried and set on texture unit 0.
+    const int restore_flags = bd->StateRestoreFlags;
+    const int query_flags = restore_flags & ~(bd->StateCachedFlags & bd->StateCacheValidFlags);
+    ImGui_ImplOpenGL3_State last_state = bd->StateCache;
+    stats->StateQueries = ImGui_ImplOpenGL3_BackupState(&last_state, query_flags & ImGui_ImplOpenGL3_StateFlags_ActiveTexture);
     glActiveTexture(GL_TEXTURE0);
-    GLuint last_program; glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&last_program);
-    GLuint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&last_texture);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
-    GLuint last_sampler; if (bd->GlVersion >= 330) { glGetIntegerv(GL_SAMPLER_BINDING, (GLint*)&last_sampler); } else { last_sampler = 0; }
-#endif
-    GLuint last_array_buffer; glGetIntegerv(GL_ARRAY_BUFFER_BINDING, (GLint*)&last_array_buffer);
-#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    GLuint last_vertex_array_object; glGetIntegerv(GL_VERTEX_ARRAY_BINDING, (GLint*)&last_vertex_array_object);
-#endif
-#ifdef IMGUI_IMPL_HAS_POLYGON_MODE
-    GLint last_polygon_mode[2]; glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode);
-#endif
-    GLint last_viewport[4]; glGetIntegerv(GL_VIEWPORT, last_viewport);
-    GLint last_scissor_box[4]; glGetIntegerv(GL_SCISSOR_BOX, last_scissor_box);
-    GLenum last_blend_src_rgb; glGetIntegerv(GL_BLEND_SRC_RGB, (GLint*)&last_blend_src_rgb);
-    GLenum last_blend_dst_rgb; glGetIntegerv(GL_BLEND_DST_RGB, (GLint*)&last_blend_dst_rgb);
-    GLenum last_blend_src_alpha; glGetIntegerv(GL_BLEND_SRC_ALPHA, (GLint*)&last_blend_src_alpha);
-    GLenum last_blend_dst_alpha; glGetIntegerv(GL_BLEND_DST_ALPHA, (GLint*)&last_blend_dst_alpha);
-    GLenum last_blend_equation_rgb; glGetIntegerv(GL_BLEND_EQUATION_RGB, (GLint*)&last_blend_equation_rgb);
-    GLenum last_blend_equation_alpha; glGetIntegerv(GL_BLEND_EQUATION_ALPHA, (GLint*)&last_blend_equation_alpha);
-    GLboolean last_enable_blend = glIsEnabled(GL_BLEND);
-    GLboolean last_enable_cull_face = glIsEnabled(GL_CULL_FACE);
-    GLboolean last_enable_depth_test = glIsEnabled(GL_DEPTH_TEST);
-    GLboolean last_enable_stencil_test = glIsEnabled(GL_STENCIL_TEST);
-    GLboolean last_enable_scissor_test = glIsEnabled(GL_SCISSOR_TEST);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
-    GLboolean last_enable_primitive_restart = (bd->GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
-#endif
+    stats->StateQueries += ImGui_ImplOpenGL3_BackupState(&last_state, query_flags & ~ImGui_ImplOpenGL3_StateFlags_ActiveTexture);
+    stats->StateQueriesAvoided = bd->StateQueriesAll - stats->StateQueries;
+    if (query_flags & bd->StateCachedFlags)
+    {
+        bd->StateCache = last_state;
+        bd->StateCacheValidFlags |= (query_flags & bd->StateCachedFlags);
+    }
 
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
@@ -436,61 +829,159 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
-    // Render command lists
+    // Indices of all draw lists can share a single vertex base if they are rebased on upload, which 16-bit indices only allow below 64k vertices.
+    // Merging draw commands from different draw lists requires it.
+    const bool rebase_indices = (sizeof(ImDrawIdx) == 4 || draw_data->TotalVtxCount <= 0x10000);
+
+    // Build batches: merge consecutive draw commands sharing texture and vertex base, with contiguous indices, and either the same scissor
+    // rectangle or no need for one. A draw command doesn't need scissoring when all its vertices are inside its scissor rectangle (checked on CPU).
+    ImVector<ImGui_ImplOpenGL3_DrawBatch>& batches = bd->Batches;
+    batches.resize(0);
+    unsigned int list_vtx_offset = 0;
+    unsigned int list_idx_offset = 0;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
-
-        // Upload vertex/index buffers
-        GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
-        GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
-        if (bd->VertexBufferSize < vtx_buffer_size)
-        {
-            bd->VertexBufferSize = vtx_buffer_size;
-            glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, NULL, GL_STREAM_DRAW);
-        }
-        if (bd->IndexBufferSize < idx_buffer_size)
-        {
-            bd->IndexBufferSize = idx_buffer_size;
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, NULL, GL_STREAM_DRAW);
-        }
-        glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data);
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)cmd_list->IdxBuffer.Data);
-
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            ImGui_ImplOpenGL3_DrawBatch batch;
+            memset(&batch, 0, sizeof(batch));
+            batch.CmdList = cmd_list;
             if (pcmd->UserCallback != NULL)
             {
-                // User callback, registered via ImDrawList::AddCallback()
-                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
-                if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
-                    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
-                else
-                    pcmd->UserCallback(cmd_list, pcmd);
+                batch.Cmd = pcmd;
+                batches.push_back(batch);
+                continue;
             }
-            else
+
+            // Project scissor/clipping rectangles into framebuffer space
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+            stats->DrawCmds++;
+
+            // Scissor rectangle (Y is inverted in OpenGL), and the same rectangle in framebuffer space
+            batch.TexId = pcmd->GetTexID();
+            batch.Scissor[0] = (int)clip_min.x;
+            batch.Scissor[1] = (int)((float)fb_height - clip_max.y);
+            batch.Scissor[2] = (int)(clip_max.x - clip_min.x);
+            batch.Scissor[3] = (int)(clip_max.y - clip_min.y);
+            ImVec2 rect_min((float)batch.Scissor[0], (float)(fb_height - batch.Scissor[1] - batch.Scissor[3]));
+            ImVec2 rect_max((float)(batch.Scissor[0] + batch.Scissor[2]), (float)(fb_height - batch.Scissor[1]));
+            bool rect_covers_framebuffer = (rect_min.x <= 0.0f && rect_min.y <= 0.0f && rect_max.x >= (float)fb_width && rect_max.y >= (float)fb_height);
+            batch.NeedScissor = !rect_covers_framebuffer && !ImGui_ImplOpenGL3_IsCmdInsideRect(cmd_list, pcmd, clip_off, clip_scale, rect_min, rect_max);
+            if (!batch.NeedScissor)
             {
-                // Project scissor/clipping rectangles into framebuffer space
-                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
-                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
-                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
-                    continue;
+                batch.Scissor[0] = batch.Scissor[1] = 0;
+                batch.Scissor[2] = fb_width;
+                batch.Scissor[3] = fb_height;
+            }
+            batch.VtxOffset = pcmd->VtxOffset + (rebase_indices ? 0 : list_vtx_offset);
+            batch.IdxOffset = pcmd->IdxOffset + list_idx_offset;
+            batch.ElemCount = pcmd->ElemCount;
+
+            ImGui_ImplOpenGL3_DrawBatch* prev = batches.Size > 0 ? &batches.back() : NULL;
+            if (prev != NULL && prev->Cmd == NULL && prev->TexId == batch.TexId && prev->VtxOffset == batch.VtxOffset && prev->IdxOffset + prev->ElemCount == batch.IdxOffset &&
+                prev->NeedScissor == batch.NeedScissor && memcmp(prev->Scissor, batch.Scissor, sizeof(batch.Scissor)) == 0)
+                prev->ElemCount += batch.ElemCount;
+            else
+                batches.push_back(batch);
+        }
+        list_vtx_offset += (unsigned int)cmd_list->VtxBuffer.Size;
+        list_idx_offset += (unsigned int)(cmd_list->IdxChunksSize + cmd_list->IdxBuffer.Size);
+    }
 
-                // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
-                glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y));
+    // Upload vertex/index buffers of all draw lists at once
+    int region_vtx_start = 0;
+    int region_idx_start = 0;
+    ImGui_ImplOpenGL3_UploadBuffers(draw_data, rebase_indices, &region_vtx_start, &region_idx_start);
 
-                // Bind texture, Draw
-                glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID());
+    // Without glDrawElementsBaseVertex(), we point vertex attributes at the vertex base of each batch instead.
+    bool use_base_vertex = false;
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
-                if (bd->GlVersion >= 320)
-                    glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset);
-                else
+    use_base_vertex = (bd->GlVersion >= 320);
 #endif
-                glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)));
+
+    // Upload glyphs rasterized during the frame (ImFontAtlasFlags_DynamicGlyphs)
+    const bool font_texture_bound = ImGui_ImplOpenGL3_UpdateFontsTexture();
+
+    // Render batches. Texture and scissor state are tracked to skip redundant calls: known on entry when we saved them, unknown after a user callback.
+    GLuint current_texture = font_texture_bound ? bd->FontTexture : last_state.Texture;
+    GLint current_scissor[4] = { last_state.ScissorBox[0], last_state.ScissorBox[1], last_state.ScissorBox[2], last_state.ScissorBox[3] };
+    const int known_flags = ImGui_ImplOpenGL3_StateFlags_Texture | ImGui_ImplOpenGL3_StateFlags_Scissor;
+    bool current_state_known = (restore_flags & known_flags) == known_flags;
+    const bool font_texture_sdf = (ImGui::GetIO().Fonts->Flags & ImFontAtlasFlags_SignedDistanceField) != 0;
+    bool current_sdf = false; // Set by ImGui_ImplOpenGL3_SetupRenderState()
+    int current_vtx_offset = 0; // Set by ImGui_ImplOpenGL3_SetupRenderState()
+    for (int batch_n = 0; batch_n < batches.Size; batch_n++)
+    {
+        const ImGui_ImplOpenGL3_DrawBatch* batch = &batches[batch_n];
+        if (batch->Cmd != NULL)
+        {
+            // User callback, registered via ImDrawList::AddCallback()
+            // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+            if (batch->Cmd->UserCallback == ImDrawCallback_ResetRenderState)
+            {
+                ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                current_vtx_offset = 0;
+                current_sdf = false;
+            }
+            else
+            {
+                batch->Cmd->UserCallback(batch->CmdList, batch->Cmd);
             }
+            current_state_known = false;
+            continue;
+        }
+
+        // Apply scissor/clipping rectangle, bind texture
+        const GLuint texture = (GLuint)(intptr_t)batch->TexId;
+        if (!current_state_known || memcmp(current_scissor, batch->Scissor, sizeof(current_scissor)) != 0)
+        {
+            glScissor(batch->Scissor[0], batch->Scissor[1], batch->Scissor[2], batch->Scissor[3]);
+            memcpy(current_scissor, batch->Scissor, sizeof(current_scissor));
+            stats->StateChanges++;
+        }
+        if (!current_state_known || current_texture != texture)
+        {
+            glBindTexture(GL_TEXTURE_2D, texture);
+            current_texture = texture;
+            stats->StateChanges++;
         }
+        const bool sdf = font_texture_sdf && texture == bd->FontTexture;
+        if (!current_state_known || current_sdf != sdf)
+        {
+            glUniform1f(bd->AttribLocationSdfEnabled, sdf ? 1.0f : 0.0f);
+            current_sdf = sdf;
+        }
+        current_state_known = true;
+
+        // Draw
+        const int vtx_offset = region_vtx_start + (int)batch->VtxOffset;
+        const void* idx_offset = (void*)(intptr_t)((region_idx_start + (int)batch->IdxOffset) * sizeof(ImDrawIdx));
+        if (!use_base_vertex && current_vtx_offset != vtx_offset)
+        {
+            ImGui_ImplOpenGL3_SetupVertexAttribs((size_t)vtx_offset * sizeof(ImDrawVert));
+            current_vtx_offset = vtx_offset;
+        }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+        if (use_base_vertex)
+            glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)batch->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_offset, (GLint)vtx_offset);
+        else
+#endif
+        glDrawElements(GL_TRIANGLES, (GLsizei)batch->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_offset);
+        stats->DrawCalls++;
     }
+    stats->DrawCallsSaved = stats->DrawCmds - stats->DrawCalls;
+    stats->StateChangesSaved = stats->DrawCmds * 2 - stats->StateChanges;
+
+    // Protect the region of our buffers used by this frame until the GPU is done with it
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_MAPPING
+    if (bd->UseBufferMapping)
+        bd->BufferFences[bd->BufferFrame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
 
     // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
@@ -498,34 +989,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #endif
 
     // Restore modified GL state
-    glUseProgram(last_program);
-    glBindTexture(GL_TEXTURE_2D, last_texture);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
-    if (bd->GlVersion >= 330)
-        glBindSampler(0, last_sampler);
-#endif
-    glActiveTexture(last_active_texture);
-#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glBindVertexArray(last_vertex_array_object);
-#endif
-    glBindBuffer(GL_ARRAY_BUFFER, last_array_buffer);
-    glBlendEquationSeparate(last_blend_equation_rgb, last_blend_equation_alpha);
-    glBlendFuncSeparate(last_blend_src_rgb, last_blend_dst_rgb, last_blend_src_alpha, last_blend_dst_alpha);
-    if (last_enable_blend) glEnable(GL_BLEND); else glDisable(GL_BLEND);
-    if (last_enable_cull_face) glEnable(GL_CULL_FACE); else glDisable(GL_CULL_FACE);
-    if (last_enable_depth_test) glEnable(GL_DEPTH_TEST); else glDisable(GL_DEPTH_TEST);
-    if (last_enable_stencil_test) glEnable(GL_STENCIL_TEST); else glDisable(GL_STENCIL_TEST);
-    if (last_enable_scissor_test) glEnable(GL_SCISSOR_TEST); else glDisable(GL_SCISSOR_TEST);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
-    if (bd->GlVersion >= 310) { if (last_enable_primitive_restart) glEnable(GL_PRIMITIVE_RESTART); else glDisable(GL_PRIMITIVE_RESTART); }
-#endif
-
-#ifdef IMGUI_IMPL_HAS_POLYGON_MODE
-    glPolygonMode(GL_FRONT_AND_BACK, (GLenum)last_polygon_mode[0]);
-#endif
-    glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]);
-    glScissor(last_scissor_box[0], last_scissor_box[1], (GLsizei)last_scissor_box[2], (GLsizei)last_scissor_box[3]);
-    (void)bd; // Not all compilation paths use this
+    ImGui_ImplOpenGL3_RestoreState(&last_state, restore_flags);
 }
 
 bool ImGui_ImplOpenGL3_CreateFontsTexture()
@@ -549,6 +1013,9 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 #endif
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    bd->FontTextureWidth = width;
+    bd->FontTextureHeight = height;
+    io.Fonts->TexDirtyRects.resize(0);
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
@@ -683,47 +1150,84 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
 
+    // The distance field path (ImFontAtlasFlags_SignedDistanceField) turns distances into coverage over about one pixel, using screen space derivatives.
+    // GLSL ES 1.00 needs the GL_OES_standard_derivatives extension for them, otherwise we use a fixed transition width.
     const GLchar* fragment_shader_glsl_120 =
+        "#if defined(GL_ES) && defined(GL_OES_standard_derivatives)\n"
+        "#extension GL_OES_standard_derivatives : enable\n"
+        "#endif\n"
         "#ifdef GL_ES\n"
         "    precision mediump float;\n"
         "#endif\n"
         "uniform sampler2D Texture;\n"
+        "uniform float SdfEnabled;\n"
         "varying vec2 Frag_UV;\n"
         "varying vec4 Frag_Color;\n"
         "void main()\n"
         "{\n"
-        "    gl_FragColor = Frag_Color * texture2D(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture2D(Texture, Frag_UV.st);\n"
+        "    if (SdfEnabled > 0.0)\n"
+        "    {\n"
+        "#if defined(GL_ES) && !defined(GL_OES_standard_derivatives)\n"
+        "        float width = 0.1;\n"
+        "#else\n"
+        "        float width = max(fwidth(tex.a) * 0.5, 1.0 / 255.0);\n"
+        "#endif\n"
+        "        tex.a = smoothstep(0.5 - width, 0.5 + width, tex.a);\n"
+        "    }\n"
+        "    gl_FragColor = Frag_Color * tex;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_130 =
         "uniform sampler2D Texture;\n"
+        "uniform float SdfEnabled;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    if (SdfEnabled > 0.0)\n"
+        "    {\n"
+        "        float width = max(fwidth(tex.a) * 0.5, 1.0 / 255.0);\n"
+        "        tex.a = smoothstep(0.5 - width, 0.5 + width, tex.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_300_es =
         "precision mediump float;\n"
         "uniform sampler2D Texture;\n"
+        "uniform float SdfEnabled;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    if (SdfEnabled > 0.0)\n"
+        "    {\n"
+        "        float width = max(fwidth(tex.a) * 0.5, 1.0 / 255.0);\n"
+        "        tex.a = smoothstep(0.5 - width, 0.5 + width, tex.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_410_core =
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "uniform sampler2D Texture;\n"
+        "uniform float SdfEnabled;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    if (SdfEnabled > 0.0)\n"
+        "    {\n"
+        "        float width = max(fwidth(tex.a) * 0.5, 1.0 / 255.0);\n"
+        "        tex.a = smoothstep(0.5 - width, 0.5 + width, tex.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex;\n"
         "}\n";
 
     // Select shaders matching our GLSL versions
@@ -777,6 +1281,7 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
+    bd->AttribLocationSdfEnabled = glGetUniformLocation(bd->ShaderHandle, "SdfEnabled");
     bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
@@ -800,8 +1305,13 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_MAPPING
+    ImGui_ImplOpenGL3_DestroyBufferFences();
+#endif
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
+    if (bd->StagingBuffer)  { IM_FREE(bd->StagingBuffer); bd->StagingBuffer = NULL; bd->StagingBufferSize = 0; }
+    bd->VertexBufferSize = bd->IndexBufferSize = 0;
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
@@ -6,6 +6,9 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Desktop GL only: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Single upload of all draw lists per frame. GL 3.2+/ES 3.0+: streamed through glMapBufferRange() (disable with '#define IMGUI_IMPL_OPENGL_DISABLE_BUFFER_MAPPING').
+//  [X] Renderer: Merging of consecutive draw commands sharing texture and scissor state, including across draw lists.
+//  [X] Renderer: Font atlas texture updates (ImFontAtlasFlags_DynamicGlyphs): sub-rectangles uploaded with glTexSubImage2D().
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -26,6 +29,45 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_Shutdown();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_NewFrame();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data);
 
+// (Optional) Statistics about the last ImGui_ImplOpenGL3_RenderDrawData() call
+struct ImGui_ImplOpenGL3_FrameStats
+{
+    int     UploadCalls;        // glBufferData()/glBufferSubData()/glMapBufferRange() calls to upload vertices and indices
+    int     UploadBytes;        // Vertex and index bytes uploaded
+    int     DrawCalls;          // glDrawElements()/glDrawElementsBaseVertex() calls
+    int     DrawCmds;           // Visible draw commands, each needing its own draw call, glScissor() and glBindTexture() without merging
+    int     StateChanges;       // glScissor()/glBindTexture() calls
+    int     DrawCallsSaved;     // DrawCmds - DrawCalls
+    int     StateChangesSaved;  // DrawCmds * 2 - StateChanges
+    int     StateQueries;       // glGet*()/glIsEnabled() calls to save GL state
+    int     StateQueriesAvoided;// glGet*()/glIsEnabled() calls skipped thanks to ImGui_ImplOpenGL3_SetStateFlags()
+};
+IMGUI_IMPL_API const ImGui_ImplOpenGL3_FrameStats* ImGui_ImplOpenGL3_GetFrameStats();
+
+// (Optional) Select the GL state saved by ImGui_ImplOpenGL3_RenderDrawData() and restored after rendering, using ImGui_ImplOpenGL3_StateFlags_ values.
+// glGet*() queries may stall the pipeline on some drivers (notably mobile GLES ones), and can be reduced:
+// - 'restore_flags': state to save and restore (default: all). Leave out state owned by your application, which always sets it before its own draws.
+// - 'cached_flags': part of 'restore_flags' queried only once, then restored from a cache. Your application must not change that state between
+//   frames, or call ImGui_ImplOpenGL3_InvalidateStateCache() after doing so.
+enum ImGui_ImplOpenGL3_StateFlags_
+{
+    ImGui_ImplOpenGL3_StateFlags_None           = 0,
+    ImGui_ImplOpenGL3_StateFlags_ActiveTexture  = 1 << 0,
+    ImGui_ImplOpenGL3_StateFlags_Program        = 1 << 1,
+    ImGui_ImplOpenGL3_StateFlags_Texture        = 1 << 2,   // GL_TEXTURE_2D binding of texture unit 0
+    ImGui_ImplOpenGL3_StateFlags_Sampler        = 1 << 3,   // Sampler binding of texture unit 0 (GL 3.3+)
+    ImGui_ImplOpenGL3_StateFlags_VertexArray    = 1 << 4,
+    ImGui_ImplOpenGL3_StateFlags_ArrayBuffer    = 1 << 5,
+    ImGui_ImplOpenGL3_StateFlags_Blend          = 1 << 6,   // Blend functions and equations
+    ImGui_ImplOpenGL3_StateFlags_Capabilities   = 1 << 7,   // GL_BLEND, GL_CULL_FACE, GL_DEPTH_TEST, GL_STENCIL_TEST, GL_SCISSOR_TEST, GL_PRIMITIVE_RESTART
+    ImGui_ImplOpenGL3_StateFlags_PolygonMode    = 1 << 8,
+    ImGui_ImplOpenGL3_StateFlags_Viewport       = 1 << 9,
+    ImGui_ImplOpenGL3_StateFlags_Scissor        = 1 << 10,  // Scissor box
+    ImGui_ImplOpenGL3_StateFlags_All            = (1 << 11) - 1
+};
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_SetStateFlags(int restore_flags, int cached_flags = ImGui_ImplOpenGL3_StateFlags_None);
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_InvalidateStateCache();
+
 // (Optional) Called by Init/NewFrame/Shutdown
 IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_CreateFontsTexture();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyFontsTexture();
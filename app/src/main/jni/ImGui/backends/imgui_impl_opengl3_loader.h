@@ -207,11 +207,13 @@ typedef khronos_float_t GLclampf;
 typedef double GLclampd;
 #define GL_TEXTURE_BINDING_2D             0x8069
 typedef void (APIENTRYP PFNGLDRAWELEMENTSPROC) (GLenum mode, GLsizei count, GLenum type, const void *indices);
+typedef void (APIENTRYP PFNGLTEXSUBIMAGE2DPROC) (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
 typedef void (APIENTRYP PFNGLBINDTEXTUREPROC) (GLenum target, GLuint texture);
 typedef void (APIENTRYP PFNGLDELETETEXTURESPROC) (GLsizei n, const GLuint *textures);
 typedef void (APIENTRYP PFNGLGENTEXTURESPROC) (GLsizei n, GLuint *textures);
 #ifdef GL_GLEXT_PROTOTYPES
 GLAPI void APIENTRY glDrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices);
+GLAPI void APIENTRY glTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
 GLAPI void APIENTRY glBindTexture (GLenum target, GLuint texture);
 GLAPI void APIENTRY glDeleteTextures (GLsizei n, const GLuint *textures);
 GLAPI void APIENTRY glGenTextures (GLsizei n, GLuint *textures);
@@ -250,12 +252,14 @@ typedef void (APIENTRYP PFNGLDELETEBUFFERSPROC) (GLsizei n, const GLuint *buffer
 typedef void (APIENTRYP PFNGLGENBUFFERSPROC) (GLsizei n, GLuint *buffers);
 typedef void (APIENTRYP PFNGLBUFFERDATAPROC) (GLenum target, GLsizeiptr size, const void *data, GLenum usage);
 typedef void (APIENTRYP PFNGLBUFFERSUBDATAPROC) (GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+typedef GLboolean (APIENTRYP PFNGLUNMAPBUFFERPROC) (GLenum target);
 #ifdef GL_GLEXT_PROTOTYPES
 GLAPI void APIENTRY glBindBuffer (GLenum target, GLuint buffer);
 GLAPI void APIENTRY glDeleteBuffers (GLsizei n, const GLuint *buffers);
 GLAPI void APIENTRY glGenBuffers (GLsizei n, GLuint *buffers);
 GLAPI void APIENTRY glBufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage);
 GLAPI void APIENTRY glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+GLAPI GLboolean APIENTRY glUnmapBuffer (GLenum target);
 #endif
 #endif /* GL_VERSION_1_5 */
 #ifndef GL_VERSION_2_0
@@ -290,6 +294,7 @@ typedef GLint (APIENTRYP PFNGLGETUNIFORMLOCATIONPROC) (GLuint program, const GLc
 typedef void (APIENTRYP PFNGLLINKPROGRAMPROC) (GLuint program);
 typedef void (APIENTRYP PFNGLSHADERSOURCEPROC) (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length);
 typedef void (APIENTRYP PFNGLUSEPROGRAMPROC) (GLuint program);
+typedef void (APIENTRYP PFNGLUNIFORM1FPROC) (GLint location, GLfloat v0);
 typedef void (APIENTRYP PFNGLUNIFORM1IPROC) (GLint location, GLint v0);
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX4FVPROC) (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 typedef void (APIENTRYP PFNGLVERTEXATTRIBPOINTERPROC) (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
@@ -312,6 +317,7 @@ GLAPI GLint APIENTRY glGetUniformLocation (GLuint program, const GLchar *name);
 GLAPI void APIENTRY glLinkProgram (GLuint program);
 GLAPI void APIENTRY glShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length);
 GLAPI void APIENTRY glUseProgram (GLuint program);
+GLAPI void APIENTRY glUniform1f (GLint location, GLfloat v0);
 GLAPI void APIENTRY glUniform1i (GLint location, GLint v0);
 GLAPI void APIENTRY glUniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 GLAPI void APIENTRY glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
@@ -324,14 +330,19 @@ typedef khronos_uint16_t GLhalf;
 #define GL_NUM_EXTENSIONS                 0x821D
 #define GL_FRAMEBUFFER_SRGB               0x8DB9
 #define GL_VERTEX_ARRAY_BINDING           0x85B5
+#define GL_MAP_WRITE_BIT                  0x0002
+#define GL_MAP_INVALIDATE_RANGE_BIT       0x0004
+#define GL_MAP_UNSYNCHRONIZED_BIT         0x0020
 typedef void (APIENTRYP PFNGLGETBOOLEANI_VPROC) (GLenum target, GLuint index, GLboolean *data);
 typedef void (APIENTRYP PFNGLGETINTEGERI_VPROC) (GLenum target, GLuint index, GLint *data);
 typedef const GLubyte *(APIENTRYP PFNGLGETSTRINGIPROC) (GLenum name, GLuint index);
+typedef void *(APIENTRYP PFNGLMAPBUFFERRANGEPROC) (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
 typedef void (APIENTRYP PFNGLBINDVERTEXARRAYPROC) (GLuint array);
 typedef void (APIENTRYP PFNGLDELETEVERTEXARRAYSPROC) (GLsizei n, const GLuint *arrays);
 typedef void (APIENTRYP PFNGLGENVERTEXARRAYSPROC) (GLsizei n, GLuint *arrays);
 #ifdef GL_GLEXT_PROTOTYPES
 GLAPI const GLubyte *APIENTRY glGetStringi (GLenum name, GLuint index);
+GLAPI void *APIENTRY glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
 GLAPI void APIENTRY glBindVertexArray (GLuint array);
 GLAPI void APIENTRY glDeleteVertexArrays (GLsizei n, const GLuint *arrays);
 GLAPI void APIENTRY glGenVertexArrays (GLsizei n, GLuint *arrays);
@@ -346,10 +357,19 @@ GLAPI void APIENTRY glGenVertexArrays (GLsizei n, GLuint *arrays);
 typedef struct __GLsync *GLsync;
 typedef khronos_uint64_t GLuint64;
 typedef khronos_int64_t GLint64;
+#define GL_SYNC_GPU_COMMANDS_COMPLETE     0x9117
+#define GL_TIMEOUT_EXPIRED                0x911B
+#define GL_SYNC_FLUSH_COMMANDS_BIT        0x00000001
 typedef void (APIENTRYP PFNGLDRAWELEMENTSBASEVERTEXPROC) (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+typedef GLsync (APIENTRYP PFNGLFENCESYNCPROC) (GLenum condition, GLbitfield flags);
+typedef void (APIENTRYP PFNGLDELETESYNCPROC) (GLsync sync);
+typedef GLenum (APIENTRYP PFNGLCLIENTWAITSYNCPROC) (GLsync sync, GLbitfield flags, GLuint64 timeout);
 typedef void (APIENTRYP PFNGLGETINTEGER64I_VPROC) (GLenum target, GLuint index, GLint64 *data);
 #ifdef GL_GLEXT_PROTOTYPES
 GLAPI void APIENTRY glDrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+GLAPI GLsync APIENTRY glFenceSync (GLenum condition, GLbitfield flags);
+GLAPI void APIENTRY glDeleteSync (GLsync sync);
+GLAPI GLenum APIENTRY glClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout);
 #endif
 #endif /* GL_VERSION_3_2 */
 #ifndef GL_VERSION_3_3
@@ -437,7 +457,7 @@ GL3W_API GL3WglProc imgl3wGetProcAddress(const char *proc);
 
 /* gl3w internal state */
 union GL3WProcs {
-    GL3WglProc ptr[54];
+    GL3WglProc ptr[61];
     struct {
         PFNGLACTIVETEXTUREPROC           ActiveTexture;
         PFNGLATTACHSHADERPROC            AttachShader;
@@ -452,12 +472,14 @@ union GL3WProcs {
         PFNGLBUFFERSUBDATAPROC           BufferSubData;
         PFNGLCLEARPROC                   Clear;
         PFNGLCLEARCOLORPROC              ClearColor;
+        PFNGLCLIENTWAITSYNCPROC          ClientWaitSync;
         PFNGLCOMPILESHADERPROC           CompileShader;
         PFNGLCREATEPROGRAMPROC           CreateProgram;
         PFNGLCREATESHADERPROC            CreateShader;
         PFNGLDELETEBUFFERSPROC           DeleteBuffers;
         PFNGLDELETEPROGRAMPROC           DeleteProgram;
         PFNGLDELETESHADERPROC            DeleteShader;
+        PFNGLDELETESYNCPROC              DeleteSync;
         PFNGLDELETETEXTURESPROC          DeleteTextures;
         PFNGLDELETEVERTEXARRAYSPROC      DeleteVertexArrays;
         PFNGLDETACHSHADERPROC            DetachShader;
@@ -466,6 +488,7 @@ union GL3WProcs {
         PFNGLDRAWELEMENTSBASEVERTEXPROC  DrawElementsBaseVertex;
         PFNGLENABLEPROC                  Enable;
         PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+        PFNGLFENCESYNCPROC               FenceSync;
         PFNGLGENBUFFERSPROC              GenBuffers;
         PFNGLGENTEXTURESPROC             GenTextures;
         PFNGLGENVERTEXARRAYSPROC         GenVertexArrays;
@@ -481,6 +504,7 @@ union GL3WProcs {
         PFNGLGETUNIFORMLOCATIONPROC      GetUniformLocation;
         PFNGLISENABLEDPROC               IsEnabled;
         PFNGLLINKPROGRAMPROC             LinkProgram;
+        PFNGLMAPBUFFERRANGEPROC          MapBufferRange;
         PFNGLPIXELSTOREIPROC             PixelStorei;
         PFNGLPOLYGONMODEPROC             PolygonMode;
         PFNGLREADPIXELSPROC              ReadPixels;
@@ -488,8 +512,11 @@ union GL3WProcs {
         PFNGLSHADERSOURCEPROC            ShaderSource;
         PFNGLTEXIMAGE2DPROC              TexImage2D;
         PFNGLTEXPARAMETERIPROC           TexParameteri;
+        PFNGLTEXSUBIMAGE2DPROC           TexSubImage2D;
+        PFNGLUNIFORM1FPROC               Uniform1f;
         PFNGLUNIFORM1IPROC               Uniform1i;
         PFNGLUNIFORMMATRIX4FVPROC        UniformMatrix4fv;
+        PFNGLUNMAPBUFFERPROC             UnmapBuffer;
         PFNGLUSEPROGRAMPROC              UseProgram;
         PFNGLVERTEXATTRIBPOINTERPROC     VertexAttribPointer;
         PFNGLVIEWPORTPROC                Viewport;
@@ -512,12 +539,14 @@ GL3W_API extern union GL3WProcs imgl3wProcs;
 #define glBufferSubData                  imgl3wProcs.gl.BufferSubData
 #define glClear                          imgl3wProcs.gl.Clear
 #define glClearColor                     imgl3wProcs.gl.ClearColor
+#define glClientWaitSync                 imgl3wProcs.gl.ClientWaitSync
 #define glCompileShader                  imgl3wProcs.gl.CompileShader
 #define glCreateProgram                  imgl3wProcs.gl.CreateProgram
 #define glCreateShader                   imgl3wProcs.gl.CreateShader
 #define glDeleteBuffers                  imgl3wProcs.gl.DeleteBuffers
 #define glDeleteProgram                  imgl3wProcs.gl.DeleteProgram
 #define glDeleteShader                   imgl3wProcs.gl.DeleteShader
+#define glDeleteSync                     imgl3wProcs.gl.DeleteSync
 #define glDeleteTextures                 imgl3wProcs.gl.DeleteTextures
 #define glDeleteVertexArrays             imgl3wProcs.gl.DeleteVertexArrays
 #define glDetachShader                   imgl3wProcs.gl.DetachShader
@@ -526,6 +555,7 @@ GL3W_API extern union GL3WProcs imgl3wProcs;
 #define glDrawElementsBaseVertex         imgl3wProcs.gl.DrawElementsBaseVertex
 #define glEnable                         imgl3wProcs.gl.Enable
 #define glEnableVertexAttribArray        imgl3wProcs.gl.EnableVertexAttribArray
+#define glFenceSync                      imgl3wProcs.gl.FenceSync
 #define glGenBuffers                     imgl3wProcs.gl.GenBuffers
 #define glGenTextures                    imgl3wProcs.gl.GenTextures
 #define glGenVertexArrays                imgl3wProcs.gl.GenVertexArrays
@@ -541,6 +571,7 @@ GL3W_API extern union GL3WProcs imgl3wProcs;
 #define glGetUniformLocation             imgl3wProcs.gl.GetUniformLocation
 #define glIsEnabled                      imgl3wProcs.gl.IsEnabled
 #define glLinkProgram                    imgl3wProcs.gl.LinkProgram
+#define glMapBufferRange                 imgl3wProcs.gl.MapBufferRange
 #define glPixelStorei                    imgl3wProcs.gl.PixelStorei
 #define glPolygonMode                    imgl3wProcs.gl.PolygonMode
 #define glReadPixels                     imgl3wProcs.gl.ReadPixels
@@ -548,8 +579,11 @@ GL3W_API extern union GL3WProcs imgl3wProcs;
 #define glShaderSource                   imgl3wProcs.gl.ShaderSource
 #define glTexImage2D                     imgl3wProcs.gl.TexImage2D
 #define glTexParameteri                  imgl3wProcs.gl.TexParameteri
+#define glTexSubImage2D                  imgl3wProcs.gl.TexSubImage2D
+#define glUniform1f                      imgl3wProcs.gl.Uniform1f
 #define glUniform1i                      imgl3wProcs.gl.Uniform1i
 #define glUniformMatrix4fv               imgl3wProcs.gl.UniformMatrix4fv
+#define glUnmapBuffer                    imgl3wProcs.gl.UnmapBuffer
 #define glUseProgram                     imgl3wProcs.gl.UseProgram
 #define glVertexAttribPointer            imgl3wProcs.gl.VertexAttribPointer
 #define glViewport                       imgl3wProcs.gl.Viewport
@@ -699,12 +733,14 @@ static const char *proc_names[] = {
     "glBufferSubData",
     "glClear",
     "glClearColor",
+    "glClientWaitSync",
     "glCompileShader",
     "glCreateProgram",
     "glCreateShader",
     "glDeleteBuffers",
     "glDeleteProgram",
     "glDeleteShader",
+    "glDeleteSync",
     "glDeleteTextures",
     "glDeleteVertexArrays",
     "glDetachShader",
@@ -713,6 +749,7 @@ static const char *proc_names[] = {
     "glDrawElementsBaseVertex",
     "glEnable",
     "glEnableVertexAttribArray",
+    "glFenceSync",
     "glGenBuffers",
     "glGenTextures",
     "glGenVertexArrays",
@@ -728,6 +765,7 @@ static const char *proc_names[] = {
     "glGetUniformLocation",
     "glIsEnabled",
     "glLinkProgram",
+    "glMapBufferRange",
     "glPixelStorei",
     "glPolygonMode",
     "glReadPixels",
@@ -735,8 +773,11 @@ static const char *proc_names[] = {
     "glShaderSource",
     "glTexImage2D",
     "glTexParameteri",
+    "glTexSubImage2D",
+    "glUniform1f",
     "glUniform1i",
     "glUniformMatrix4fv",
+    "glUnmapBuffer",
     "glUseProgram",
     "glVertexAttribPointer",
     "glViewport",
@@ -55,6 +55,45 @@
 //---- Pack colors to BGRA8 instead of RGBA8 (to avoid converting from one to another)
 //#define IMGUI_USE_BGRA_PACKED_COLOR
 
+//---- Use NEON intrinsics on AArch64 for the SIMD code paths also available with SSE (polyline tessellation, UTF-8 conversion).
+// Opt-in until those paths are validated on AArch64 hardware with the tools in misc/tests/. The scalar code is used otherwise.
+//#define IMGUI_USE_NEON
+
+//---- Select the hash function used by ImHashData()/ImHashStr() (and therefore by every ImGuiID computed from a label).
+// The default is a table-driven CRC32 processing 1 byte per step. The '###' operator and the GetID() contract are preserved by all variants.
+// - IMGUI_USE_HW_CRC32: use CRC32 instructions when compiled with them enabled (e.g. '-march=armv8-a+crc', '-msse4.2'), else fall back to the table.
+//   On ARM the result is identical to the default. On x86 the instruction computes CRC32C, so IDs will differ from the default.
+// - IMGUI_USE_FAST_HASH: use a word-at-a-time hash (4 bytes per step). IDs will differ from the default.
+// IDs persisted in .ini files (e.g. [Table] settings) won't match after changing the hash function.
+//#define IMGUI_USE_HW_CRC32
+//#define IMGUI_USE_FAST_HASH
+
+//---- Use a hash table instead of a sorted array in ImGuiStorage (used for tree node open state, window lookup by ID, per-window state storage).
+// Lookups and insertions become O(1) instead of O(log N) lookups and O(N) insertions. Storages with few entries don't allocate the table.
+// ImGuiStorage::Data is then kept in insertion order instead of being sorted by key.
+//#define IMGUI_USE_HASHED_STORAGE
+
+//---- Number of sets (4 entries each) of the text layout cache reusing CalcTextSize() results and wrapped text lines across frames. Must be a power of two, 0 disables the cache.
+// The cache keeps a copy of each text and its line offsets, up to IMGUI_TEXT_LAYOUT_CACHE_MEMORY bytes (default 4 MB). Longer texts are not cached.
+//#define IMGUI_TEXT_LAYOUT_CACHE_SETS 256
+//#define IMGUI_TEXT_LAYOUT_CACHE_MEMORY (4 * 1024 * 1024)
+
+//---- Max size in bytes of the undo/redo history of the active InputText() (default 1 MB). The history is allocated on the first edit of a field and grown as needed.
+// Past this size the oldest undo states are discarded, and a single edit larger than it can't be undone.
+//#define IMGUI_INPUT_TEXT_UNDO_MEMORY (1024 * 1024)
+
+//---- Use std::thread to collect and rasterize font atlas glyphs on multiple threads (see ImFontAtlas::BuildThreadsCount). The texture is identical to the one built on a single thread.
+// Requires threads support from the platform/toolchain (e.g. '-pthread'). If you use SetAllocatorFunctions(), your allocator must be thread-safe.
+//#define IMGUI_ENABLE_THREADED_FONT_BUILD
+
+//---- Use std::thread to sort large tables on multiple threads in ImGuiTableSortIndex (see ImGuiTableSortIndex::ThreadsCount). The order is identical to the one sorted on a single thread.
+// Requires threads support from the platform/toolchain (e.g. '-pthread'). Your compare function will be called from several threads at once.
+//#define IMGUI_ENABLE_THREADED_TABLE_SORT
+
+//---- Use std::thread to write the .ini file in the background when settings are saved (see SaveIniSettingsToDisk()). The file is written next to the destination then renamed over it.
+// Requires threads support from the platform/toolchain (e.g. '-pthread').
+//#define IMGUI_ENABLE_THREADED_INI_SAVE
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
@@ -90,6 +129,12 @@
         operator MyVec4() const { return MyVec4(x,y,z,w); }
 */
 
+//---- Define constructor to convert your string types to ImStrv (the begin/end string view accepted by label-taking widgets, e.g. Button(), Selectable(), TreeNode()).
+/*
+#define IM_STRV_CLASS_EXTRA                                                     \
+        ImStrv(const std::string_view& s) { Begin = s.data(); End = Begin + s.size(); }
+*/
+
 //---- Use 32-bit vertex indices (default is 16-bit) is one way to allow large meshes with more than 64K vertices.
 // Your renderer backend will need to support it (most example renderer backends support both 16/32-bit indices).
 // Another way to allow large meshes while keeping 16-bit indices is to handle ImDrawCmd::VtxOffset in your renderer.
@@ -823,6 +823,14 @@ CODE
 #else
 #include <stdint.h>     // intptr_t
 #endif
+// The background .ini writer relies on the default file functions
+#if defined(IMGUI_ENABLE_THREADED_INI_SAVE) && defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS)
+#undef IMGUI_ENABLE_THREADED_INI_SAVE
+#endif
+#ifdef IMGUI_ENABLE_THREADED_INI_SAVE
+#include <thread>       // std::thread
+#include <atomic>       // std::atomic
+#endif
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -912,6 +920,9 @@ static const float WINDOWS_HOVER_PADDING                    = 4.0f;     // Exten
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
 
+// Idle frames (see IsLastFrameClean())
+static const float IDLE_FRAME_HOVER_SETTLE_TIMER            = 1.00f;    // Hovered items may change appearance over time (resize border highlight, tooltips, tab expansion) until hovered for that long.
+
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
 //-------------------------------------------------------------------------
@@ -930,6 +941,9 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+#ifdef IMGUI_ENABLE_THREADED_INI_SAVE
+static void             SettingsSaveJobFinish(ImGuiContext* ctx);
+#endif
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data);
@@ -971,6 +985,10 @@ static void             UpdateSettings();
 static void             UpdateKeyboardInputs();
 static void             UpdateMouseInputs();
 static void             UpdateMouseWheel();
+static void             UpdateFrameClean();
+static void             UpdateWindowDrawListCache(ImGuiWindow* window, const char* name, bool title_bar_is_highlight, bool render_decorations_in_parent);
+static void             SwapWindowDrawListCache(ImGuiWindow* window);
+static void             UpdateTextLayoutCache();
 static bool             UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1070,6 +1088,7 @@ ImGuiStyle::ImGuiStyle()
     AntiAliasedLines        = true;             // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU.
     AntiAliasedLinesUseTex  = true;             // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering.
     AntiAliasedFill         = true;             // Enable anti-aliased filled shapes (rounded rectangles, circles, etc.).
+    JoinedLines             = false;            // Join segments of lines/borders drawn without anti-aliasing.
     CurveTessellationTol    = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     CircleTessellationMaxError = 0.30f;         // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
 
@@ -1149,6 +1168,8 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigIdleFramesMaxSkip = 30;
+    ConfigWindowsCacheMaxFrames = 30;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1679,6 +1700,8 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 }
 #endif // #ifdef IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
 
+#if !defined(IMGUI_USE_FAST_HASH) && !defined(IMGUI_ENABLE_ARM_CRC32) && !defined(IMGUI_ENABLE_SSE42_CRC32)
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -1749,6 +1772,80 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
     return ~crc;
 }
 
+#else
+
+// Word-at-a-time hash backends (see IMGUI_USE_HW_CRC32 and IMGUI_USE_FAST_HASH in imconfig.h)
+// Unaligned read through memcpy(): compiles to a single load on targets supporting unaligned access.
+static inline ImU32 ImHashRead32(const unsigned char* p) { ImU32 v; memcpy(&v, p, 4); return v; }
+
+#if defined(IMGUI_USE_FAST_HASH)
+// Derived from MurmurHash3_x86_32 (public domain), consuming 4 bytes per step.
+static inline ImU32 ImHashMix32(ImU32 k) { k *= 0xCC9E2D51; k = (k << 15) | (k >> 17); return k * 0x1B873593; }
+static ImU32 ImHashBytes(const unsigned char* data, size_t data_size, ImU32 seed)
+{
+    ImU32 h = seed;
+    for (size_t n = data_size >> 2; n != 0; n--, data += 4)
+    {
+        h ^= ImHashMix32(ImHashRead32(data));
+        h = (h << 13) | (h >> 19);
+        h = h * 5 + 0xE6546B64;
+    }
+    ImU32 k = 0;
+    if (data_size & 2) { k = (ImU32)data[0] | ((ImU32)data[1] << 8); data += 2; }
+    if (data_size & 1) { k |= (ImU32)data[0] << ((data_size & 2) ? 16 : 0); }
+    if (data_size & 3)
+        h ^= ImHashMix32(k);
+    h ^= (ImU32)data_size;
+    h ^= h >> 16; h *= 0x85EBCA6B;
+    h ^= h >> 13; h *= 0xC2B2AE35;
+    h ^= h >> 16;
+    return h;
+}
+#else
+// CRC32 instructions. ARMv8 CRC32 uses the same polynomial as GCrc32LookupTable, SSE 4.2 uses the CRC32C polynomial.
+static ImU32 ImHashBytes(const unsigned char* data, size_t data_size, ImU32 seed)
+{
+    ImU32 crc = ~seed;
+#if defined(IMGUI_ENABLE_ARM_CRC32)
+    for (; data_size >= 4; data_size -= 4, data += 4)
+        crc = __crc32w(crc, ImHashRead32(data));
+    while (data_size-- != 0)
+        crc = __crc32b(crc, *data++);
+#else
+    for (; data_size >= 4; data_size -= 4, data += 4)
+        crc = _mm_crc32_u32(crc, ImHashRead32(data));
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+#endif
+    return ~crc;
+}
+#endif
+
+// Known size hash
+// It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
+ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+{
+    return ImHashBytes((const unsigned char*)data_p, data_size, seed);
+}
+
+// Zero-terminated string hash, with support for ### to reset back to seed value
+// We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
+// - Hashing restarts from the seed at the last ### of the string, so we locate it first (memchr() is vectorized by most libc)
+//   then hash the remaining bytes in one go. This matches the semantic of the byte-by-byte CRC32 version.
+ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
+{
+    const unsigned char* data = (const unsigned char*)data_p;
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const unsigned char* data_end = data + data_size;
+    for (const unsigned char* p = data; (p = (const unsigned char*)memchr(p, '#', (size_t)(data_end - p))) != NULL; p++)
+        if (data_end - p >= 3 && p[1] == '#' && p[2] == '#')
+            data = p;
+    return ImHashBytes(data, (size_t)(data_end - data), seed);
+}
+
+#endif // #if !defined(IMGUI_USE_FAST_HASH) && !defined(IMGUI_ENABLE_ARM_CRC32) && !defined(IMGUI_ENABLE_SSE42_CRC32)
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -1778,6 +1875,26 @@ bool    ImFileClose(ImFileHandle f)     { return fclose(f) == 0; }
 ImU64   ImFileGetSize(ImFileHandle f)   { long off = 0, sz = 0; return ((off = ftell(f)) != -1 && !fseek(f, 0, SEEK_END) && (sz = ftell(f)) != -1 && !fseek(f, off, SEEK_SET)) ? (ImU64)sz : (ImU64)-1; }
 ImU64   ImFileRead(void* data, ImU64 sz, ImU64 count, ImFileHandle f)           { return fread(data, (size_t)sz, (size_t)count, f); }
 ImU64   ImFileWrite(const void* data, ImU64 sz, ImU64 count, ImFileHandle f)    { return fwrite(data, (size_t)sz, (size_t)count, f); }
+
+// Rename 'old_filename' to 'new_filename', replacing any existing file.
+// This is atomic on POSIX systems and with MoveFileEx() on Windows: other readers either see the previous or the new file, never a partially written one.
+bool ImFileRename(const char* old_filename, const char* new_filename)
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__)
+    const int old_wsize = ::MultiByteToWideChar(CP_UTF8, 0, old_filename, -1, NULL, 0);
+    const int new_wsize = ::MultiByteToWideChar(CP_UTF8, 0, new_filename, -1, NULL, 0);
+    ImVector<ImWchar> buf;
+    buf.resize(old_wsize + new_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, old_filename, -1, (wchar_t*)&buf[0], old_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, new_filename, -1, (wchar_t*)&buf[old_wsize], new_wsize);
+    return ::MoveFileExW((const wchar_t*)&buf[0], (const wchar_t*)&buf[old_wsize], MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+#if defined(_WIN32)
+    remove(new_filename); // rename() doesn't replace existing files on Windows
+#endif
+    return rename(old_filename, new_filename) == 0;
+#endif
+}
 #endif // #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 
 // Helper: Load file content into memory
@@ -1826,6 +1943,207 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
 
+// SIMD helpers for the ImText* string conversion functions below, scanning and converting 16 characters at a time.
+// The Scan functions return the length of the leading run of characters of the same kind (out of the next 16):
+// - ImTextSimdScanUtf8(): whether the run is made of bytes in the 0x01..0x7F range, which the scalar code would convert one to one.
+// - ImTextSimdScanWide(): the UTF-8 size of the characters of the run, 1 (0x01..0x7F), 2 (0x80..0x7FF) or 0 (anything else).
+// Runs of those kinds are converted by SIMD code producing the exact same output as the scalar code. Other runs (terminator, 3 or 4 bytes sequences,
+// malformed UTF-8) are left to the scalar code, without scanning again until we are past them.
+// The Convert functions always write 16 characters: the caller only advances past the run and must have room for them before its terminator.
+// ImTextSimdCountUtf8Bytes16() returns the UTF-8 size of 16 characters in the 0x0001..0xFFFF range, or -1 if any of them is outside of that range.
+#if defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)
+#define IM_TEXT_SIMD
+#ifdef _MSC_VER
+#include <intrin.h>         // _BitScanForward, _BitScanForward64
+#endif
+#if defined(IMGUI_ENABLE_SSE)
+typedef unsigned int ImTextSimdMask;    // 1 bit per character
+static inline ImTextSimdMask ImTextSimdMaskNot(ImTextSimdMask mask)     { return ~mask & 0xFFFF; }
+static inline int ImTextSimdMaskFirstSet(ImTextSimdMask mask)
+{
+    if (mask == 0)
+        return 16;
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long n;
+    _BitScanForward(&n, (unsigned long)mask);
+    return (int)n;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+// Load 16 ImWchar into two vectors of 16-bit lanes. With 32-bit ImWchar, values above 0x7FFF saturate to 0x7FFF: this preserves their UTF-8 size when <= 0xFFFF,
+// makes them 3 bytes characters otherwise (the scalar code handles them as any non 1 or 2 bytes character), and zero stays zero.
+static inline void ImTextSimdLoadWide16(const ImWchar* s, __m128i* a, __m128i* b)
+{
+#ifdef IMGUI_USE_WCHAR32
+    *a = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)(s + 0)), _mm_loadu_si128((const __m128i*)(s + 4)));
+    *b = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)(s + 8)), _mm_loadu_si128((const __m128i*)(s + 12)));
+#else
+    *a = _mm_loadu_si128((const __m128i*)(s + 0));
+    *b = _mm_loadu_si128((const __m128i*)(s + 8));
+#endif
+}
+static inline int ImTextSimdScanUtf8(const char* s, bool* out_is_ascii)
+{
+    __m128i v = _mm_loadu_si128((const __m128i*)s);
+    __m128i zero = _mm_setzero_si128();
+    ImTextSimdMask not_ascii = (ImTextSimdMask)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, zero), _mm_cmplt_epi8(v, zero)));
+    *out_is_ascii = (not_ascii & 1) == 0;
+    return ImTextSimdMaskFirstSet(*out_is_ascii ? not_ascii : ImTextSimdMaskNot(not_ascii));
+}
+static inline int ImTextSimdScanWide(const ImWchar* s, int* out_utf8_size)
+{
+    __m128i a, b;
+    ImTextSimdLoadWide16(s, &a, &b);
+    __m128i zero = _mm_setzero_si128();
+    __m128i below_80_a = _mm_cmpeq_epi16(_mm_and_si128(a, _mm_set1_epi16((short)0xFF80)), zero), below_80_b = _mm_cmpeq_epi16(_mm_and_si128(b, _mm_set1_epi16((short)0xFF80)), zero);
+    __m128i below_800_a = _mm_cmpeq_epi16(_mm_and_si128(a, _mm_set1_epi16((short)0xF800)), zero), below_800_b = _mm_cmpeq_epi16(_mm_and_si128(b, _mm_set1_epi16((short)0xF800)), zero);
+    ImTextSimdMask is_1 = (ImTextSimdMask)_mm_movemask_epi8(_mm_packs_epi16(_mm_andnot_si128(_mm_cmpeq_epi16(a, zero), below_80_a), _mm_andnot_si128(_mm_cmpeq_epi16(b, zero), below_80_b)));
+    ImTextSimdMask is_2 = (ImTextSimdMask)_mm_movemask_epi8(_mm_packs_epi16(_mm_andnot_si128(below_80_a, below_800_a), _mm_andnot_si128(below_80_b, below_800_b)));
+    *out_utf8_size = (is_1 & 1) ? 1 : (is_2 & 1) ? 2 : 0;
+    return ImTextSimdMaskFirstSet(*out_utf8_size == 1 ? ImTextSimdMaskNot(is_1) : *out_utf8_size == 2 ? ImTextSimdMaskNot(is_2) : (is_1 | is_2));
+}
+static inline void ImTextSimdConvertUtf8Ascii16(ImWchar* dst, const char* s)
+{
+    __m128i v = _mm_loadu_si128((const __m128i*)s);
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+#ifdef IMGUI_USE_WCHAR32
+    _mm_storeu_si128((__m128i*)(dst + 0), _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(dst + 4), _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(dst + 8), _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128((__m128i*)(dst + 12), _mm_unpackhi_epi16(hi, zero));
+#else
+    _mm_storeu_si128((__m128i*)(dst + 0), lo);
+    _mm_storeu_si128((__m128i*)(dst + 8), hi);
+#endif
+}
+static inline void ImTextSimdConvertWideAscii16(char* dst, const ImWchar* s)
+{
+    __m128i a, b;
+    ImTextSimdLoadWide16(s, &a, &b);
+    _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(a, b));
+}
+static inline void ImTextSimdConvertWide2Bytes16(char* dst, const ImWchar* s) // Write 32 bytes
+{
+    __m128i a, b;
+    ImTextSimdLoadWide16(s, &a, &b);
+    __m128i lead = _mm_set1_epi16(0xC0), tail = _mm_set1_epi16(0x80), tail_bits = _mm_set1_epi16(0x3F);
+    _mm_storeu_si128((__m128i*)(dst + 0), _mm_or_si128(_mm_or_si128(_mm_srli_epi16(a, 6), lead), _mm_slli_epi16(_mm_or_si128(_mm_and_si128(a, tail_bits), tail), 8)));
+    _mm_storeu_si128((__m128i*)(dst + 16), _mm_or_si128(_mm_or_si128(_mm_srli_epi16(b, 6), lead), _mm_slli_epi16(_mm_or_si128(_mm_and_si128(b, tail_bits), tail), 8)));
+}
+static inline int ImTextSimdCountUtf8Bytes16(const ImWchar* s)
+{
+    __m128i zero = _mm_setzero_si128();
+#ifdef IMGUI_USE_WCHAR32
+    __m128i any = _mm_or_si128(_mm_or_si128(_mm_loadu_si128((const __m128i*)(s + 0)), _mm_loadu_si128((const __m128i*)(s + 4))), _mm_or_si128(_mm_loadu_si128((const __m128i*)(s + 8)), _mm_loadu_si128((const __m128i*)(s + 12))));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, _mm_set1_epi32((int)0xFFFF0000)), zero)) != 0xFFFF)
+        return -1;
+#endif
+    __m128i a, b;
+    ImTextSimdLoadWide16(s, &a, &b);
+    if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(a, zero), _mm_cmpeq_epi16(b, zero))) != 0)
+        return -1;
+    __m128i below_80 = _mm_set1_epi16((short)0xFF80), below_800 = _mm_set1_epi16((short)0xF800);
+    __m128i sum = _mm_add_epi16(_mm_add_epi16(_mm_cmpeq_epi16(_mm_and_si128(a, below_80), zero), _mm_cmpeq_epi16(_mm_and_si128(a, below_800), zero)),
+                                _mm_add_epi16(_mm_cmpeq_epi16(_mm_and_si128(b, below_80), zero), _mm_cmpeq_epi16(_mm_and_si128(b, below_800), zero))); // -1 per byte below 3
+    sum = _mm_madd_epi16(sum, _mm_set1_epi16(1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    return 16 * 3 + _mm_cvtsi128_si32(sum);
+}
+#else
+typedef uint64_t ImTextSimdMask;        // 4 bits per character
+static inline ImTextSimdMask ImTextSimdMaskNot(ImTextSimdMask mask)     { return ~mask; }
+static inline ImTextSimdMask ImTextSimdMaskFromLanes(uint8x16_t lanes)  { return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(lanes), 4)), 0); }
+static inline int ImTextSimdMaskFirstSet(ImTextSimdMask mask)
+{
+    if (mask == 0)
+        return 16;
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long n;
+    _BitScanForward64(&n, mask);
+    return (int)(n >> 2);
+#else
+    return __builtin_ctzll(mask) >> 2;
+#endif
+}
+// Load 16 ImWchar into two vectors of 16-bit lanes. With 32-bit ImWchar, values above 0xFFFF saturate to 0xFFFF: this makes them 3 bytes characters
+// (the scalar code handles them as any non 1 or 2 bytes character), and zero stays zero.
+static inline void ImTextSimdLoadWide16(const ImWchar* s, uint16x8_t* a, uint16x8_t* b)
+{
+#ifdef IMGUI_USE_WCHAR32
+    *a = vcombine_u16(vqmovn_u32(vld1q_u32((const uint32_t*)(s + 0))), vqmovn_u32(vld1q_u32((const uint32_t*)(s + 4))));
+    *b = vcombine_u16(vqmovn_u32(vld1q_u32((const uint32_t*)(s + 8))), vqmovn_u32(vld1q_u32((const uint32_t*)(s + 12))));
+#else
+    *a = vld1q_u16((const uint16_t*)(s + 0));
+    *b = vld1q_u16((const uint16_t*)(s + 8));
+#endif
+}
+static inline int ImTextSimdScanUtf8(const char* s, bool* out_is_ascii)
+{
+    ImTextSimdMask not_ascii = ImTextSimdMaskFromLanes(vclezq_s8(vld1q_s8((const int8_t*)s))); // 0 or >= 0x80
+    *out_is_ascii = (not_ascii & 1) == 0;
+    return ImTextSimdMaskFirstSet(*out_is_ascii ? not_ascii : ImTextSimdMaskNot(not_ascii));
+}
+static inline int ImTextSimdScanWide(const ImWchar* s, int* out_utf8_size)
+{
+    uint16x8_t a, b;
+    ImTextSimdLoadWide16(s, &a, &b);
+    uint16x8_t above_80 = vdupq_n_u16(0x80), above_800 = vdupq_n_u16(0x800);
+    ImTextSimdMask is_1 = ImTextSimdMaskFromLanes(vcombine_u8(vmovn_u16(vandq_u16(vtstq_u16(a, a), vcltq_u16(a, above_80))), vmovn_u16(vandq_u16(vtstq_u16(b, b), vcltq_u16(b, above_80)))));
+    ImTextSimdMask is_2 = ImTextSimdMaskFromLanes(vcombine_u8(vmovn_u16(vandq_u16(vcgeq_u16(a, above_80), vcltq_u16(a, above_800))), vmovn_u16(vandq_u16(vcgeq_u16(b, above_80), vcltq_u16(b, above_800)))));
+    *out_utf8_size = (is_1 & 1) ? 1 : (is_2 & 1) ? 2 : 0;
+    return ImTextSimdMaskFirstSet(*out_utf8_size == 1 ? ImTextSimdMaskNot(is_1) : *out_utf8_size == 2 ? ImTextSimdMaskNot(is_2) : (is_1 | is_2));
+}
+static inline void ImTextSimdConvertUtf8Ascii16(ImWchar* dst, const char* s)
+{
+    uint8x16_t v = vld1q_u8((const uint8_t*)s);
+    uint16x8_t lo = vmovl_u8(vget_low_u8(v)), hi = vmovl_u8(vget_high_u8(v));
+#ifdef IMGUI_USE_WCHAR32
+    vst1q_u32((uint32_t*)(dst + 0), vmovl_u16(vget_low_u16(lo)));
+    vst1q_u32((uint32_t*)(dst + 4), vmovl_u16(vget_high_u16(lo)));
+    vst1q_u32((uint32_t*)(dst + 8), vmovl_u16(vget_low_u16(hi)));
+    vst1q_u32((uint32_t*)(dst + 12), vmovl_u16(vget_high_u16(hi)));
+#else
+    vst1q_u16((uint16_t*)(dst + 0), lo);
+    vst1q_u16((uint16_t*)(dst + 8), hi);
+#endif
+}
+static inline void ImTextSimdConvertWideAscii16(char* dst, const ImWchar* s)
+{
+    uint16x8_t a, b;
+    ImTextSimdLoadWide16(s, &a, &b);
+    vst1q_u8((uint8_t*)dst, vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+}
+static inline void ImTextSimdConvertWide2Bytes16(char* dst, const ImWchar* s) // Write 32 bytes
+{
+    uint16x8_t a, b;
+    ImTextSimdLoadWide16(s, &a, &b);
+    uint8x8x2_t out_a = { { vorr_u8(vmovn_u16(vshrq_n_u16(a, 6)), vdup_n_u8(0xC0)), vorr_u8(vand_u8(vmovn_u16(a), vdup_n_u8(0x3F)), vdup_n_u8(0x80)) } };
+    uint8x8x2_t out_b = { { vorr_u8(vmovn_u16(vshrq_n_u16(b, 6)), vdup_n_u8(0xC0)), vorr_u8(vand_u8(vmovn_u16(b), vdup_n_u8(0x3F)), vdup_n_u8(0x80)) } };
+    vst2_u8((uint8_t*)(dst + 0), out_a);
+    vst2_u8((uint8_t*)(dst + 16), out_b);
+}
+static inline int ImTextSimdCountUtf8Bytes16(const ImWchar* s)
+{
+#ifdef IMGUI_USE_WCHAR32
+    uint32x4_t any = vorrq_u32(vorrq_u32(vld1q_u32((const uint32_t*)(s + 0)), vld1q_u32((const uint32_t*)(s + 4))), vorrq_u32(vld1q_u32((const uint32_t*)(s + 8)), vld1q_u32((const uint32_t*)(s + 12))));
+    if (vmaxvq_u32(any) > 0xFFFF)
+        return -1;
+#endif
+    uint16x8_t a, b;
+    ImTextSimdLoadWide16(s, &a, &b);
+    if (vminvq_u16(vminq_u16(a, b)) == 0)
+        return -1;
+    uint16x8_t above_80 = vdupq_n_u16(0x80), above_800 = vdupq_n_u16(0x800);
+    uint16x8_t sum = vaddq_u16(vaddq_u16(vshrq_n_u16(vcgeq_u16(a, above_80), 15), vshrq_n_u16(vcgeq_u16(a, above_800), 15)),
+                               vaddq_u16(vshrq_n_u16(vcgeq_u16(b, above_80), 15), vshrq_n_u16(vcgeq_u16(b, above_800), 15))); // +1 per byte above 1
+    return 16 + (int)vaddvq_u16(sum);
+}
+#endif
+#endif // #if defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)
+
 // Convert UTF-8 to 32-bit character, process single character input.
 // A nearly-branchless UTF-8 decoder, based on work of Christopher Wellons (https://github.com/skeeto/branchless-utf8).
 // We handle UTF-8 decoding error by skipping forward.
@@ -1836,11 +2154,21 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     static const uint32_t mins[] = { 0x400000, 0, 0x80, 0x800, 0x10000 };
     static const int shiftc[] = { 0, 18, 12, 6, 0 };
     static const int shifte[] = { 0, 6, 4, 2, 0 };
+    if ((in_text_end == NULL || in_text < in_text_end) && *(const unsigned char*)in_text < 0x80)
+    {
+        *out_char = *(const unsigned char*)in_text; // Fast path for ASCII, including the terminator (which is consumed like any other 1-byte character)
+        return 1;
+    }
     int len = lengths[*(const unsigned char*)in_text >> 3];
     int wanted = len + !len;
 
     if (in_text_end == NULL)
-        in_text_end = in_text + wanted; // Max length, nulls will be taken into account.
+    {
+        // Max length, stopping at the zero terminator so truncated sequences at the end of the string don't read past it.
+        in_text_end = in_text + 1;
+        while (in_text_end < in_text + wanted && *in_text_end != 0)
+            in_text_end++;
+    }
 
     // Copy at most 'len' bytes, stop copying at 0 or past in_text_end. Branch predictor does a good job here,
     // so it is fast even with excessive branching.
@@ -1885,8 +2213,28 @@ int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const cha
 {
     ImWchar* buf_out = buf;
     ImWchar* buf_end = buf + buf_size;
+#ifdef IM_TEXT_SIMD
+    const char* simd_end = in_text_end ? in_text_end : in_text + strlen(in_text);
+    const char* simd_skip_until = in_text;
+#endif
     while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
+#ifdef IM_TEXT_SIMD
+        if (in_text >= simd_skip_until && simd_end - in_text >= 16 && buf_end - buf_out > 16)
+        {
+            bool is_ascii;
+            const int n = ImTextSimdScanUtf8(in_text, &is_ascii);
+            if (!is_ascii)
+                simd_skip_until = in_text + n;
+            else
+            {
+                ImTextSimdConvertUtf8Ascii16(buf_out, in_text);
+                in_text += n;
+                buf_out += n;
+                continue;
+            }
+        }
+#endif
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         if (c == 0)
@@ -1902,8 +2250,27 @@ int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const cha
 int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
 {
     int char_count = 0;
+#ifdef IM_TEXT_SIMD
+    const char* simd_end = in_text_end ? in_text_end : in_text + strlen(in_text);
+    const char* simd_skip_until = in_text;
+#endif
     while ((!in_text_end || in_text < in_text_end) && *in_text)
     {
+#ifdef IM_TEXT_SIMD
+        if (in_text >= simd_skip_until && simd_end - in_text >= 16)
+        {
+            bool is_ascii;
+            const int n = ImTextSimdScanUtf8(in_text, &is_ascii);
+            if (!is_ascii)
+                simd_skip_until = in_text + n;
+            else
+            {
+                in_text += n;
+                char_count += n;
+                continue;
+            }
+        }
+#endif
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         if (c == 0)
@@ -1976,8 +2343,31 @@ int ImTextStrToUtf8(char* out_buf, int out_buf_size, const ImWchar* in_text, con
 {
     char* buf_p = out_buf;
     const char* buf_end = out_buf + out_buf_size;
+#ifdef IM_TEXT_SIMD
+    const ImWchar* simd_skip_until = in_text;
+#endif
     while (buf_p < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
+#ifdef IM_TEXT_SIMD
+        // Only when the end is known: with a NULL end we can't tell whether the 16 characters are readable.
+        if (in_text_end && in_text >= simd_skip_until && in_text_end - in_text >= 16 && buf_end - buf_p > 32)
+        {
+            int utf8_size;
+            const int n = ImTextSimdScanWide(in_text, &utf8_size);
+            if (utf8_size == 0)
+                simd_skip_until = in_text + n;
+            else
+            {
+                if (utf8_size == 1)
+                    ImTextSimdConvertWideAscii16(buf_p, in_text);
+                else
+                    ImTextSimdConvertWide2Bytes16(buf_p, in_text);
+                in_text += n;
+                buf_p += n * utf8_size;
+                continue;
+            }
+        }
+#endif
         unsigned int c = (unsigned int)(*in_text++);
         if (c < 0x80)
             *buf_p++ = (char)c;
@@ -1991,8 +2381,25 @@ int ImTextStrToUtf8(char* out_buf, int out_buf_size, const ImWchar* in_text, con
 int ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end)
 {
     int bytes_count = 0;
+#ifdef IM_TEXT_SIMD
+    const ImWchar* simd_skip_until = in_text;
+#endif
     while ((!in_text_end || in_text < in_text_end) && *in_text)
     {
+#ifdef IM_TEXT_SIMD
+        if (in_text_end && in_text >= simd_skip_until && in_text_end - in_text >= 16)
+        {
+            const int n = ImTextSimdCountUtf8Bytes16(in_text);
+            if (n < 0)
+                simd_skip_until = in_text + 16;
+            else
+            {
+                in_text += 16;
+                bytes_count += n;
+                continue;
+            }
+        }
+#endif
         unsigned int c = (unsigned int)(*in_text++);
         if (c < 0x80)
             bytes_count++;
@@ -2092,6 +2499,8 @@ void ImGui::ColorConvertHSVtoRGB(float h, float s, float v, float& out_r, float&
 // Helper: Key->value storage
 //-----------------------------------------------------------------------------
 
+#ifndef IMGUI_USE_HASHED_STORAGE
+
 // std::lower_bound but without the bullshit
 static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiStoragePair>& data, ImGuiID key)
 {
@@ -2115,6 +2524,88 @@ static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiSt
     return first;
 }
 
+static ImGuiStorage::ImGuiStoragePair* StorageFindPair(ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(storage->Data, key);
+    return (it == storage->Data.end() || it->key != key) ? NULL : it;
+}
+
+// Caller must have checked that the key is missing
+static ImGuiStorage::ImGuiStoragePair* StorageAddPair(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& pair)
+{
+    return storage->Data.insert(LowerBound(storage->Data, pair.key), pair);
+}
+
+#else
+
+// Open-addressing index with linear probing over Data (which stays in insertion order).
+// Storages with less than IMGUI_STORAGE_INDEX_MIN_SIZE pairs (most per-window storages) are scanned linearly and don't allocate an index.
+// The index is kept at most half full.
+#define IMGUI_STORAGE_INDEX_MIN_SIZE    16
+
+static inline int StorageIndexSlot(ImGuiID key, int mask)
+{
+    key ^= key >> 16;
+    key *= 0x45D9F3B;
+    key ^= key >> 16;
+    return (int)(key & (ImU32)mask);
+}
+
+static void StorageIndexInsert(ImGuiStorage* storage, int data_n)
+{
+    const int mask = storage->Index.Size - 1;
+    int slot = StorageIndexSlot(storage->Data[data_n].key, mask);
+    while (storage->Index.Data[slot] != 0)
+        slot = (slot + 1) & mask;
+    storage->Index.Data[slot] = data_n + 1;
+}
+
+static void StorageIndexRebuild(ImGuiStorage* storage)
+{
+    int index_size = IMGUI_STORAGE_INDEX_MIN_SIZE * 2;
+    while (index_size < storage->Data.Size * 2)
+        index_size *= 2;
+    storage->Index.resize(index_size);
+    memset(storage->Index.Data, 0, (size_t)storage->Index.size_in_bytes());
+    for (int n = 0; n < storage->Data.Size; n++)
+        StorageIndexInsert(storage, n);
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFindPair(ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStorage::ImGuiStoragePair* data = storage->Data.Data;
+    if (storage->Index.Size == 0)
+    {
+        for (int n = 0; n < storage->Data.Size; n++)
+            if (data[n].key == key)
+                return &data[n];
+        return NULL;
+    }
+    const int mask = storage->Index.Size - 1;
+    for (int slot = StorageIndexSlot(key, mask); storage->Index.Data[slot] != 0; slot = (slot + 1) & mask)
+        if (data[storage->Index.Data[slot] - 1].key == key)
+            return &data[storage->Index.Data[slot] - 1];
+    return NULL;
+}
+
+// Caller must have checked that the key is missing
+static ImGuiStorage::ImGuiStoragePair* StorageAddPair(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& pair)
+{
+    storage->Data.push_back(pair);
+    if (storage->Data.Size * 2 > storage->Index.Size)
+    {
+        if (storage->Data.Size >= IMGUI_STORAGE_INDEX_MIN_SIZE)
+            StorageIndexRebuild(storage);
+    }
+    else
+    {
+        StorageIndexInsert(storage, storage->Data.Size - 1);
+    }
+    return &storage->Data.back();
+}
+
+#endif // #ifndef IMGUI_USE_HASHED_STORAGE
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -2129,14 +2620,18 @@ void ImGuiStorage::BuildSortByKey()
         }
     };
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairComparerByID);
+#ifdef IMGUI_USE_HASHED_STORAGE
+    if (Data.Size >= IMGUI_STORAGE_INDEX_MIN_SIZE)
+        StorageIndexRebuild(this);
+    else
+        Index.clear();
+#endif
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = StorageFindPair(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2146,26 +2641,22 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = StorageFindPair(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = StorageFindPair(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    if (it == NULL)
+        it = StorageAddPair(this, ImGuiStoragePair(key, default_val));
     return &it->val_i;
 }
 
@@ -2176,30 +2667,27 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    if (it == NULL)
+        it = StorageAddPair(this, ImGuiStoragePair(key, default_val));
     return &it->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    if (it == NULL)
+        it = StorageAddPair(this, ImGuiStoragePair(key, default_val));
     return &it->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_i = val;
+    if (ImGuiStoragePair* it = StorageFindPair(this, key))
+        it->val_i = val;
+    else
+        StorageAddPair(this, ImGuiStoragePair(key, val));
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2209,24 +2697,18 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_f = val;
+    if (ImGuiStoragePair* it = StorageFindPair(this, key))
+        it->val_f = val;
+    else
+        StorageAddPair(this, ImGuiStoragePair(key, val));
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_p = val;
+    if (ImGuiStoragePair* it = StorageFindPair(this, key))
+        it->val_p = val;
+    else
+        StorageAddPair(this, ImGuiStoragePair(key, val));
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2492,6 +2974,37 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
+static void ImGuiListClipper_AddRanges(ImGuiListClipper* clipper)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    const int items_count = clipper->ItemsCount;
+    if (g.LogEnabled)
+    {
+        // If logging is active, do not perform any clipping
+        data->Ranges.push_back(ImGuiListClipperRange::FromIndices(0, items_count));
+        return;
+    }
+
+    // Add range selected to be included for navigation
+    const bool is_nav_request = (g.NavMoveScoringItems && g.NavWindow && g.NavWindow->RootWindowForNav == window->RootWindowForNav);
+    if (is_nav_request)
+        data->Ranges.push_back(ImGuiListClipperRange::FromPositions(g.NavScoringNoClipRect.Min.y, g.NavScoringNoClipRect.Max.y, 0, 0));
+    if (is_nav_request && (g.NavMoveFlags & ImGuiNavMoveFlags_Tabbing) && g.NavTabbingDir == -1)
+        data->Ranges.push_back(ImGuiListClipperRange::FromIndices(items_count - 1, items_count));
+
+    // Add focused/active item
+    ImRect nav_rect_abs = ImGui::WindowRectRelToAbs(window, window->NavRectRel[0]);
+    if (g.NavId != 0 && window->NavLastIds[0] == g.NavId)
+        data->Ranges.push_back(ImGuiListClipperRange::FromPositions(nav_rect_abs.Min.y, nav_rect_abs.Max.y, 0, 0));
+
+    // Add visible range
+    const int off_min = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Up) ? -1 : 0;
+    const int off_max = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Down) ? 1 : 0;
+    data->Ranges.push_back(ImGuiListClipperRange::FromPositions(window->ClipRect.Min.y, window->ClipRect.Max.y, off_min, off_max));
+}
+
 static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
@@ -2522,10 +3035,92 @@ static void ImGuiListClipper_SeekCursorForItem(ImGuiListClipper* clipper, int it
     // StartPosY starts from ItemsFrozen hence the subtraction
     // Perform the add and multiply with double to allow seeking through larger ranges
     ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    if (ImGuiListClipperHeightIndex* heights = clipper->HeightIndex)
+    {
+        // Seeking from the end of the last displayed item (DisplayEnd): use the average height of the skipped items as line height so tables count skipped rows correctly.
+        const double offset = heights->GetOffset(item_n);
+        const int skipped_count = item_n - clipper->DisplayEnd;
+        float line_height = (skipped_count > 0) ? (float)((offset - heights->GetOffset(clipper->DisplayEnd)) / skipped_count) : (item_n > 0) ? heights->GetHeight(item_n - 1) : 0.0f;
+        if (line_height <= 0.0f)
+            line_height = heights->DefaultHeight;
+        float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + offset - heights->GetOffset(data->ItemsFrozen));
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, line_height);
+        return;
+    }
     float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (double)(item_n - data->ItemsFrozen) * clipper->ItemsHeight);
     ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight);
 }
 
+// Step with a height index: display items one at a time so we can measure them, and convert positions to items with the index.
+static bool ImGuiListClipper_StepWithHeightIndex(ImGuiListClipper* clipper)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    ImGuiListClipperHeightIndex* heights = clipper->HeightIndex;
+
+    // Record the height of the item displayed by the previous step
+    if (data->ItemStartPosY != FLT_MAX)
+    {
+        heights->SetHeight(clipper->DisplayStart, ImMax(window->DC.CursorPos.y - data->ItemStartPosY, 0.0f));
+        data->ItemStartPosY = FLT_MAX;
+    }
+
+    // Step 0: Calculate the ranges of items to display. Following steps use Ranges[StepNo - 1].
+    if (data->StepNo == 0)
+    {
+        clipper->StartPosY = window->DC.CursorPos.y;
+        ImGuiListClipper_AddRanges(clipper);
+        const double base_offset = heights->GetOffset(data->ItemsFrozen) - clipper->StartPosY - data->LossynessOffset;
+        for (int i = 0; i < data->Ranges.Size; i++)
+            if (data->Ranges[i].PosToIndexConvert)
+            {
+                ImGuiListClipperRange& range = data->Ranges[i];
+                int m1 = heights->FindItemAtOffset(base_offset + range.Min);
+                int m2 = heights->FindItemAtOffset(base_offset + range.Max) + 1;
+                range.Min = ImClamp(m1 + range.PosToIndexOffsetMin, data->ItemsFrozen, clipper->ItemsCount - 1);
+                range.Max = ImClamp(m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
+                range.PosToIndexConvert = false;
+            }
+        ImGuiListClipper_SortAndFuseRanges(data->Ranges);
+        data->StepNo = 1;
+    }
+
+    // Display the next item in line
+    const int submitted_end = clipper->DisplayEnd;
+    for (; data->StepNo <= data->Ranges.Size; data->StepNo++)
+    {
+        ImGuiListClipperRange& range = data->Ranges[data->StepNo - 1];
+        int item_n = ImMax(range.Min, submitted_end);
+        if (item_n >= clipper->ItemsCount)
+            break;
+        if (item_n >= range.Max)
+        {
+            // Ranges were calculated with the heights known at step 0: extend them until the visible area is filled after measuring new heights.
+            // Items which are known to end above the visible area (e.g. after a scroll jump over items that turned out shorter than estimated) are skipped, not displayed.
+            if (item_n != submitted_end)
+                continue;
+            float item_y = window->DC.CursorPos.y;
+            while (item_n < clipper->ItemsCount && item_y + heights->GetHeight(item_n) <= window->ClipRect.Min.y)
+                item_y += heights->GetHeight(item_n++);
+            if (item_n >= clipper->ItemsCount || item_y >= window->ClipRect.Max.y)
+                continue;
+            range.Max = item_n + 1;
+        }
+        if (item_n > submitted_end)
+            ImGuiListClipper_SeekCursorForItem(clipper, item_n);
+        clipper->DisplayStart = item_n;
+        clipper->DisplayEnd = item_n + 1;
+        data->ItemStartPosY = window->DC.CursorPos.y;
+        return true;
+    }
+
+    // After the last step: advance the cursor to the end of the list
+    ImGuiListClipper_SeekCursorForItem(clipper, clipper->ItemsCount);
+    clipper->End();
+    return false;
+}
+
 ImGuiListClipper::ImGuiListClipper()
 {
     memset(this, 0, sizeof(*this));
@@ -2554,6 +3149,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     ItemsCount = items_count;
     DisplayStart = -1;
     DisplayEnd = 0;
+    HeightIndex = NULL;
 
     // Acquire temporary buffer
     if (++g.ClipperTempDataStacked > g.ClipperTempData.Size)
@@ -2564,6 +3160,16 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     TempData = data;
 }
 
+void ImGuiListClipper::Begin(int items_count, ImGuiListClipperHeightIndex* height_index)
+{
+    IM_ASSERT(height_index != NULL && items_count >= 0 && items_count < INT_MAX);
+    if (height_index->DefaultHeight <= 0.0f)
+        height_index->DefaultHeight = ImGui::GetTextLineHeightWithSpacing();
+    height_index->Resize(items_count);
+    Begin(items_count, height_index->DefaultHeight);
+    HeightIndex = height_index;
+}
+
 void ImGuiListClipper::End()
 {
     ImGuiContext& g = *GImGui;
@@ -2622,6 +3228,9 @@ bool ImGuiListClipper::Step()
         return true;
     }
 
+    if (HeightIndex != NULL)
+        return ImGuiListClipper_StepWithHeightIndex(this);
+
     // Step 0: Let you process the first element (regardless of it being visible or not, so we can measure the element height)
     bool calc_clipping = false;
     if (data->StepNo == 0)
@@ -2661,30 +3270,7 @@ bool ImGuiListClipper::Step()
     const int already_submitted = DisplayEnd;
     if (calc_clipping)
     {
-        if (g.LogEnabled)
-        {
-            // If logging is active, do not perform any clipping
-            data->Ranges.push_back(ImGuiListClipperRange::FromIndices(0, ItemsCount));
-        }
-        else
-        {
-            // Add range selected to be included for navigation
-            const bool is_nav_request = (g.NavMoveScoringItems && g.NavWindow && g.NavWindow->RootWindowForNav == window->RootWindowForNav);
-            if (is_nav_request)
-                data->Ranges.push_back(ImGuiListClipperRange::FromPositions(g.NavScoringNoClipRect.Min.y, g.NavScoringNoClipRect.Max.y, 0, 0));
-            if (is_nav_request && (g.NavMoveFlags & ImGuiNavMoveFlags_Tabbing) && g.NavTabbingDir == -1)
-                data->Ranges.push_back(ImGuiListClipperRange::FromIndices(ItemsCount - 1, ItemsCount));
-
-            // Add focused/active item
-            ImRect nav_rect_abs = ImGui::WindowRectRelToAbs(window, window->NavRectRel[0]);
-            if (g.NavId != 0 && window->NavLastIds[0] == g.NavId)
-                data->Ranges.push_back(ImGuiListClipperRange::FromPositions(nav_rect_abs.Min.y, nav_rect_abs.Max.y, 0, 0));
-
-            // Add visible range
-            const int off_min = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Up) ? -1 : 0;
-            const int off_max = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Down) ? 1 : 0;
-            data->Ranges.push_back(ImGuiListClipperRange::FromPositions(window->ClipRect.Min.y, window->ClipRect.Max.y, off_min, off_max));
-        }
+        ImGuiListClipper_AddRanges(this);
 
         // Convert position ranges to item index ranges
         // - Very important: when a starting position is after our maximum item, we set Min to (ItemsCount - 1). This allows us to handle most forms of wrapping.
@@ -2722,6 +3308,60 @@ bool ImGuiListClipper::Step()
     return false;
 }
 
+void ImGuiListClipperHeightIndex::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    int item_n = Heights.Size;
+    Heights.resize(items_count, DefaultHeight);
+    Tree.resize(items_count);
+
+    // Nodes of existing items still cover the same items. Node 'n' covers items [n - (n & -n), n): sum its own item and the nodes of its sub-ranges.
+    for (; item_n < items_count; item_n++)
+    {
+        const int node = item_n + 1;
+        double sum = Heights[item_n];
+        for (int child = node - 1; child > node - (node & -node); child -= child & -child)
+            sum += Tree[child - 1];
+        Tree[item_n] = sum;
+    }
+}
+
+void ImGuiListClipperHeightIndex::SetHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size);
+    const double delta = (double)height - Heights[item_n];
+    if (delta == 0.0)
+        return;
+    Heights[item_n] = height;
+    for (int node = item_n + 1; node <= Tree.Size; node += node & -node)
+        Tree[node - 1] += delta;
+}
+
+double ImGuiListClipperHeightIndex::GetOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Tree.Size);
+    double offset = 0.0;
+    for (int node = item_n; node > 0; node -= node & -node)
+        offset += Tree[node - 1];
+    return offset;
+}
+
+int ImGuiListClipperHeightIndex::FindItemAtOffset(double offset) const
+{
+    // Descend the tree to find the largest number of items whose total height is <= offset
+    int step = 1;
+    while (step * 2 <= Tree.Size)
+        step *= 2;
+    int item_n = 0;
+    for (; step > 0; step >>= 1)
+        if (item_n + step <= Tree.Size && Tree[item_n + step - 1] <= offset)
+        {
+            item_n += step;
+            offset -= Tree[item_n - 1];
+        }
+    return ImMin(item_n, ImMax(Tree.Size - 1, 0));
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -3003,12 +3643,40 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
     if (!text_end)
         text_end = text + strlen(text); // FIXME-OPT
 
-    if (text != text_end)
+    if (text == text_end)
+        return;
+
+    // Render line by line from the text layout cache, skipping lines outside of the clipping rectangle.
+    // Lines are drawn at the same positions as ImFont::RenderText() would, which requires an integer line height as they are pixel aligned again.
+    ImGuiTextLayoutCacheEntry* entry = (wrap_width > 0.0f) ? GetTextLayoutCacheEntry(text, text_end, wrap_width) : NULL;
+    const float line_height = g.Font->FontSize * (g.FontSize / g.Font->FontSize); // Same as ImFont::RenderText()
+    if (entry != NULL && line_height == IM_FLOOR(line_height))
+    {
+        if (!entry->HasLines)
+        {
+            CalcWrappedTextLines(g.Font, g.FontSize, text, text_end, wrap_width, &entry->Lines);
+            entry->HasLines = true;
+            g.TextLayoutCacheMissCount++;
+        }
+        else
+        {
+            g.TextLayoutCacheHitCount++;
+        }
+        ImDrawList* draw_list = window->DrawList;
+        const ImVec4& clip_rect = draw_list->_CmdHeader.ClipRect;
+        const ImU32 col = GetColorU32(ImGuiCol_Text);
+        const float x = IM_FLOOR(pos.x);
+        float y = IM_FLOOR(pos.y);
+        for (int n = 0; n < entry->Lines.Size && y <= clip_rect.w; n += 2, y += line_height)
+            if (y + line_height >= clip_rect.y)
+                draw_list->AddText(g.Font, g.FontSize, ImVec2(x, y), col, text + entry->Lines[n], text + entry->Lines[n + 1]);
+    }
+    else
     {
         window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
-        if (g.LogEnabled)
-            LogRenderedText(&pos, text, text_end);
     }
+    if (g.LogEnabled)
+        LogRenderedText(&pos, text, text_end);
 }
 
 // Default clip_rect uses (pos_min,pos_max)
@@ -3041,10 +3709,14 @@ void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, co
     }
 }
 
-void ImGui::RenderTextClipped(const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align, const ImRect* clip_rect)
+void ImGui::RenderTextClipped(const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align, const ImRect* clip_rect, bool hide_text_after_hash)
 {
-    // Hide anything after a '##' string
-    const char* text_display_end = FindRenderedTextEnd(text, text_end);
+    // Hide anything after a '##' string (callers which already know the display end pass hide_text_after_hash=false)
+    const char* text_display_end;
+    if (hide_text_after_hash)
+        text_display_end = FindRenderedTextEnd(text, text_end);
+    else
+        text_display_end = text_end ? text_end : text + strlen(text);
     const int text_len = (int)(text_display_end - text);
     if (text_len == 0)
         return;
@@ -3267,6 +3939,12 @@ ImGuiID ImGuiWindow::GetID(const char* str, const char* str_end)
     return id;
 }
 
+// Empty views are hashed as "" so a non zero-terminated empty view doesn't get scanned by ImHashStr()
+ImGuiID ImGuiWindow::GetID(ImStrv str)
+{
+    return str.empty() ? GetID("", NULL) : GetID(str.Begin, str.End);
+}
+
 ImGuiID ImGuiWindow::GetID(const void* ptr)
 {
     ImGuiID seed = IDStack.back();
@@ -3343,6 +4021,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     ImGuiContext& g = *GImGui;
     g.ItemFlagsStack.clear();
     g.GroupStack.clear();
+    g.TextLayoutCache.clear_destruct();
     TableGcCompactSettings();
 }
 
@@ -3357,6 +4036,10 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
+    window->DrawListCacheValid = false;
+    window->DrawListCacheCmdBuffer.clear();
+    window->DrawListCacheIdxBuffer.clear();
+    window->DrawListCacheVtxBuffer.clear();
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
@@ -4270,6 +4953,8 @@ void ImGui::NewFrame()
     g.FrameCount += 1;
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
+    g.WindowsCacheHitCount = g.WindowsCacheMissCount = 0;
+    g.TextLayoutCacheHitCount = g.TextLayoutCacheMissCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
 
     // Calculate frame-rate for the user, as a purely luxurious feature
@@ -4282,9 +4967,12 @@ void ImGui::NewFrame()
     UpdateViewportsNewFrame();
 
     // Setup current font and draw list shared data
+    // (with ImFontAtlasFlags_DynamicGlyphs, grow the texture first if glyphs didn't fit in it during last frame)
+    ImFontAtlasBuildUpdateDynamicGlyphs(g.IO.Fonts);
     g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
+    UpdateTextLayoutCache();
     ImRect virtual_space(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
     for (int n = 0; n < g.Viewports.Size; n++)
         virtual_space.Add(g.Viewports[n]->GetMainRect());
@@ -4298,8 +4986,12 @@ void ImGui::NewFrame()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
+    if (g.Style.JoinedLines)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_JoinedLines;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasIdxChunks)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowIdxChunks;
 
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     for (int n = 0; n < g.Viewports.Size; n++)
@@ -4380,6 +5072,14 @@ void ImGui::NewFrame()
     // Update mouse input state
     UpdateMouseInputs();
 
+    // Detect input for idle frames (legacy backends may write to io.MousePos/io.MouseDown[]/io.KeysDown[] directly)
+    g.FrameHadInput = (g.InputEventsTrail.Size > 0 || g.IO.MouseDelta.x != 0.0f || g.IO.MouseDelta.y != 0.0f || g.IO.MouseWheel != 0.0f || g.IO.MouseWheelH != 0.0f);
+    for (int n = 0; n < IM_ARRAYSIZE(g.IO.MouseDown) && !g.FrameHadInput; n++)
+        g.FrameHadInput = g.IO.MouseDown[n];
+    for (int n = 0; n < IM_ARRAYSIZE(g.IO.KeysData) && !g.FrameHadInput; n++)
+        g.FrameHadInput = g.IO.KeysData[n].Down;
+    g.FramesSkipped = 0;
+
     // Find hovered window
     // (needs to be before UpdateMouseMovingWindowNewFrame so we fill g.HoveredWindowUnderMovingWindow on the mouse release frame)
     UpdateHoveredWindowAndCaptureFlags();
@@ -4512,6 +5212,14 @@ void ImGui::Shutdown(ImGuiContext* context)
         SaveIniSettingsToDisk(g.IO.IniFilename);
         SetCurrentContext(backup_context);
     }
+#ifdef IMGUI_ENABLE_THREADED_INI_SAVE
+    if (g.SettingsSaveJob)
+    {
+        SettingsSaveJobFinish(&g);
+        IM_DELETE(g.SettingsSaveJob);
+        g.SettingsSaveJob = NULL;
+    }
+#endif
 
     CallContextHooks(&g, ImGuiContextHookType_Shutdown);
 
@@ -4539,6 +5247,7 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.ShrinkWidthBuffer.clear();
 
     g.ClipperTempData.clear_destruct();
+    g.TextLayoutCache.clear_destruct();
 
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
@@ -4549,7 +5258,9 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.InputTextState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsById.Clear();
     g.SettingsHandlers.clear();
+    g.SettingsIniDataPrev.clear();
 
     if (g.LogFile)
     {
@@ -4686,7 +5397,7 @@ static void SetupViewportDrawData(ImGuiViewportP* viewport, ImVector<ImDrawList*
         ImDrawList* draw_list = draw_lists->Data[n];
         draw_list->_PopUnusedDrawCmd();
         draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
-        draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+        draw_data->TotalIdxCount += draw_list->IdxChunksSize + draw_list->IdxBuffer.Size;
     }
 }
 
@@ -4860,6 +5571,10 @@ void ImGui::EndFrame()
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
     g.Windows.swap(g.WindowsTempSortBuffer);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
+    g.IO.MetricsWindowsCacheHits = g.WindowsCacheHitCount;
+    g.IO.MetricsWindowsCacheMisses = g.WindowsCacheMissCount;
+    g.IO.MetricsTextLayoutCacheHits = g.TextLayoutCacheHitCount;
+    g.IO.MetricsTextLayoutCacheMisses = g.TextLayoutCacheMissCount;
 
     // Unlock font atlas
     g.IO.Fonts->Locked = false;
@@ -4937,9 +5652,78 @@ void ImGui::Render()
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
     }
 
+    if (first_render_of_frame)
+        UpdateFrameClean();
+
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
+// A frame is "clean" when it had no input, no active item, running animation or timer (which could change the next frames
+// without input), and the same draw data as the frame before. Draw data is only hashed when other conditions are met.
+static void ImGui::UpdateFrameClean()
+{
+    ImGuiContext& g = *GImGui;
+    bool clean = !g.FrameHadInput && g.ActiveId == 0 && !g.DragDropActive && !g.NavAnyRequest && g.NavWindowingTarget == NULL && g.WheelingWindow == NULL && g.SettingsDirtyTimer <= 0.0f;
+    if (clean && g.HoveredId != 0 && (g.HoveredId != g.HoveredIdPreviousFrame || g.HoveredIdTimer < IDLE_FRAME_HOVER_SETTLE_TIMER))
+        clean = false;
+
+    ImGuiID hash = 0;
+    if (clean)
+    {
+        ImDrawData* draw_data = &g.Viewports[0]->DrawDataP;
+        hash = ImHashData(&draw_data->DisplayPos, sizeof(ImVec2) * 2, draw_data->CmdListsCount);
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+        {
+            const ImDrawList* draw_list = draw_data->CmdLists[n];
+            hash = ImHashData(draw_list->CmdBuffer.Data, (size_t)draw_list->CmdBuffer.size_in_bytes(), hash);
+            for (int chunk_n = 0; chunk_n < draw_list->IdxChunks.Size; chunk_n++)
+                hash = ImHashData(draw_list->IdxChunks[chunk_n].Data, (size_t)draw_list->IdxChunks[chunk_n].size_in_bytes(), hash);
+            hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+            hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+        }
+        clean = (hash == g.FrameDrawDataHash);
+    }
+    g.FrameClean = clean;
+    g.FrameDrawDataHash = hash;
+    g.FrameCleanMousePos = g.IO.MousePos;
+    g.FrameCleanDisplaySize = g.IO.DisplaySize;
+}
+
+bool ImGui::IsLastFrameClean()
+{
+    ImGuiContext& g = *GImGui;
+    return g.FrameClean;
+}
+
+bool ImGui::CanSkipFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    if (!g.FrameClean || g.FrameCountRendered != g.FrameCount || g.FramesSkipped >= io.ConfigIdleFramesMaxSkip)
+        return false;
+
+    // Any new input since the last frame?
+    if (g.InputEventsQueue.Size > 0 || io.MouseWheel != 0.0f || io.MouseWheelH != 0.0f)
+        return false;
+    if (io.MousePos.x != g.FrameCleanMousePos.x || io.MousePos.y != g.FrameCleanMousePos.y || io.DisplaySize.x != g.FrameCleanDisplaySize.x || io.DisplaySize.y != g.FrameCleanDisplaySize.y)
+        return false;
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown); n++)
+        if (io.MouseDown[n])
+            return false;
+#ifndef IMGUI_DISABLE_OBSOLETE_KEYIO
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown); n++)
+        if (io.KeysDown[n])
+            return false;
+#endif
+
+    // Glyphs waiting for the font atlas texture to grow (ImFontAtlasFlags_DynamicGlyphs)
+    if (ImFontAtlasBuildHasPendingGlyphs(io.Fonts))
+        return false;
+
+    g.FramesSkipped++;
+    return true;
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -4956,6 +5740,15 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+    if (text_display_end == NULL)
+        text_display_end = text + strlen(text);
+
+    ImGuiTextLayoutCacheEntry* entry = GetTextLayoutCacheEntry(text, text_display_end, wrap_width);
+    if (entry != NULL && entry->HasSize)
+    {
+        g.TextLayoutCacheHitCount++;
+        return entry->Size;
+    }
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
@@ -4965,9 +5758,191 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
     text_size.x = IM_FLOOR(text_size.x + 0.99999f);
 
+    if (entry != NULL)
+    {
+        entry->Size = text_size;
+        entry->HasSize = true;
+        g.TextLayoutCacheMissCount++;
+    }
     return text_size;
 }
 
+ImVec2 ImGui::CalcTextSize(ImStrv text, bool hide_text_after_double_hash, float wrap_width)
+{
+    return CalcTextSize(text.Begin, text.End, hide_text_after_double_hash, wrap_width);
+}
+
+// Split text into the lines ImFont::RenderText() would output with word-wrapping: [begin, end) offsets pairs, in 'out_lines'.
+// This follows the same steps as ImFont::RenderText(), line breaks are decided by the same ImFont::CalcWordWrapPositionA() calls.
+void ImGui::CalcWrappedTextLines(ImFont* font, float size, const char* text, const char* text_end, float wrap_width, ImVector<int>* out_lines)
+{
+    out_lines->resize(0);
+    const float scale = size / font->FontSize;
+    const char* word_wrap_eol = NULL;
+    const char* line_begin = text;
+    const char* s = text;
+    while (s < text_end)
+    {
+        if (!word_wrap_eol)
+        {
+            word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width);
+            if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
+                word_wrap_eol++;
+        }
+
+        if (s >= word_wrap_eol)
+        {
+            out_lines->push_back((int)(line_begin - text));
+            out_lines->push_back((int)(s - text));
+            word_wrap_eol = NULL;
+
+            // Wrapping skips upcoming blanks
+            while (s < text_end)
+            {
+                const char c = *s;
+                if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+            }
+            line_begin = s;
+            continue;
+        }
+
+        const char* prev_s = s;
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+        {
+            s += 1;
+        }
+        else
+        {
+            s += ImTextCharFromUtf8(&c, s, text_end);
+            if (c == 0) // Malformed UTF-8?
+            {
+                s = prev_s;
+                break;
+            }
+        }
+        if (c == '\n')
+        {
+            out_lines->push_back((int)(line_begin - text));
+            out_lines->push_back((int)(prev_s - text));
+            line_begin = s;
+        }
+    }
+    if (line_begin < s)
+    {
+        out_lines->push_back((int)(line_begin - text));
+        out_lines->push_back((int)(s - text));
+    }
+}
+
+static size_t TextLayoutCacheEntryMemory(const ImGuiTextLayoutCacheEntry* entry)
+{
+    return (size_t)entry->TextCopy.Capacity + (size_t)entry->Lines.Capacity * sizeof(int);
+}
+
+// Clear the text layout cache when fonts were rebuilt (glyph advances may have changed while ImFont pointers stayed the same).
+// Release least recently used entries when text copies and line offsets take more than IMGUI_TEXT_LAYOUT_CACHE_MEMORY bytes.
+static void ImGui::UpdateTextLayoutCache()
+{
+    ImGuiContext& g = *GImGui;
+    if (g.TextLayoutCacheEntriesReplaced)
+    {
+        g.TextLayoutCacheEntriesReplaced = false;
+        size_t memory = 0;
+        for (int n = 0; n < g.TextLayoutCache.Size; n++)
+            memory += TextLayoutCacheEntryMemory(&g.TextLayoutCache[n]);
+        while (memory > IMGUI_TEXT_LAYOUT_CACHE_MEMORY)
+        {
+            ImGuiTextLayoutCacheEntry* lru = NULL;
+            for (int n = 0; n < g.TextLayoutCache.Size; n++)
+            {
+                ImGuiTextLayoutCacheEntry* e = &g.TextLayoutCache[n];
+                if (TextLayoutCacheEntryMemory(e) > 0 && (lru == NULL || e->LastFrameUsed < lru->LastFrameUsed))
+                    lru = e;
+            }
+            memory -= TextLayoutCacheEntryMemory(lru);
+            lru->TextCopy.clear();
+            lru->Lines.clear();
+            lru->LastFrameUsed = -1;
+        }
+    }
+
+    ImFontAtlas* atlas = g.IO.Fonts;
+    ImU32 stamp = ImHashData(&atlas->Fonts.Size, sizeof(int), 0);
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+    {
+        const ImFont* font = atlas->Fonts[n];
+        const void* font_state[] = { font, font->IndexAdvanceX.Data };
+        const float font_metrics[] = { font->FontSize, font->FallbackAdvanceX, (float)font->IndexAdvanceX.Size };
+        stamp = ImHashData(font_state, sizeof(font_state), stamp);
+        stamp = ImHashData(font_metrics, sizeof(font_metrics), stamp);
+    }
+    if (stamp == g.TextLayoutCacheFontsStamp)
+        return;
+    g.TextLayoutCacheFontsStamp = stamp;
+    for (int n = 0; n < g.TextLayoutCache.Size; n++)
+        g.TextLayoutCache[n].LastFrameUsed = -1;
+}
+
+// Find the text layout cache entry for a text measured/rendered with the current font, or replace the least recently used entry of its set.
+// Return NULL when the text isn't worth caching. Callers fill the result on a new entry (HasSize/HasLines are false).
+ImGuiTextLayoutCacheEntry* ImGui::GetTextLayoutCacheEntry(const char* text, const char* text_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    const int text_len = (int)(text_end - text);
+    if (IMGUI_TEXT_LAYOUT_CACHE_SETS == 0 || text_len < IMGUI_TEXT_LAYOUT_CACHE_MIN_LEN || (size_t)text_len > IMGUI_TEXT_LAYOUT_CACHE_MEMORY)
+        return NULL;
+    if (g.TextLayoutCache.Size == 0)
+    {
+        g.TextLayoutCache.resize(IMGUI_TEXT_LAYOUT_CACHE_SETS * IMGUI_TEXT_LAYOUT_CACHE_WAYS);
+        memset((void*)g.TextLayoutCache.Data, 0, (size_t)g.TextLayoutCache.size_in_bytes());
+        for (int n = 0; n < g.TextLayoutCache.Size; n++)
+            g.TextLayoutCache[n].LastFrameUsed = -1;
+    }
+
+    // Select set from text pointer and length (multiplicative hashing)
+    ImU64 key = (ImU64)(size_t)text ^ ((ImU64)text_len << 48);
+    key *= 0x9E3779B97F4A7C15ULL;
+    ImGuiTextLayoutCacheEntry* set = &g.TextLayoutCache[((int)(key >> 32) & (IMGUI_TEXT_LAYOUT_CACHE_SETS - 1)) * IMGUI_TEXT_LAYOUT_CACHE_WAYS];
+
+    ImGuiTextLayoutCacheEntry* entry = NULL;
+    for (int way = 0; way < IMGUI_TEXT_LAYOUT_CACHE_WAYS; way++)
+    {
+        ImGuiTextLayoutCacheEntry* e = &set[way];
+        if (e->LastFrameUsed >= 0 && e->Text == text && e->TextLen == text_len && e->Font == g.Font && e->FontSize == g.FontSize && e->WrapWidth == wrap_width)
+        {
+            entry = e;
+            if (memcmp(e->TextCopy.Data, text, (size_t)text_len) == 0)
+            {
+                e->LastFrameUsed = g.FrameCount;
+                return e;
+            }
+            break; // Contents of the buffer changed: replace this entry
+        }
+        if (entry == NULL || e->LastFrameUsed < entry->LastFrameUsed)
+            entry = e;
+    }
+
+    // Don't keep a large buffer for a smaller text. Lines of an entry already returned this frame may still be in use by the caller.
+    if (entry->TextCopy.Capacity > text_len * 2)
+        entry->TextCopy.clear();
+    if (entry->Lines.Capacity > text_len * 2 + 2 && entry->LastFrameUsed != g.FrameCount)
+        entry->Lines.clear();
+    g.TextLayoutCacheEntriesReplaced = true;
+
+    entry->Text = text;
+    entry->TextLen = text_len;
+    entry->Font = g.Font;
+    entry->FontSize = g.FontSize;
+    entry->WrapWidth = wrap_width;
+    entry->LastFrameUsed = g.FrameCount;
+    entry->HasSize = entry->HasLines = false;
+    entry->LinesWidth = -1.0f;
+    entry->TextCopy.resize(text_len);
+    memcpy(entry->TextCopy.Data, text, (size_t)text_len);
+    return entry;
+}
+
 // Find window given position, search front-to-back
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
@@ -5431,6 +6406,8 @@ static void CalcWindowContentSizes(ImGuiWindow* window, ImVec2* content_size_cur
         preserve_old_content_sizes = true;
     else if (window->Hidden && window->HiddenFramesCannotSkipItems == 0 && window->HiddenFramesCanSkipItems > 0)
         preserve_old_content_sizes = true;
+    else if (window->DrawListCacheHit)
+        preserve_old_content_sizes = true;
     if (preserve_old_content_sizes)
     {
         *content_size_current = window->ContentSize;
@@ -5967,6 +6944,87 @@ static ImGuiWindow* ImGui::FindBlockingModal(ImGuiWindow* window)
     return NULL;
 }
 
+// Exchange the draw list buffers with the ones stored in the window (ImGuiWindowFlags_CacheDrawList).
+// Write pointers are recomputed so the draw list can be appended to and sanity checked as if it had just been built.
+// Index data linked by ImDrawListSplitter::Merge() is flattened first, as only IdxBuffer is cached.
+static void ImGui::SwapWindowDrawListCache(ImGuiWindow* window)
+{
+    ImDrawList* draw_list = window->DrawList;
+    draw_list->_FlattenIdxChunks();
+    draw_list->CmdBuffer.swap(window->DrawListCacheCmdBuffer);
+    draw_list->IdxBuffer.swap(window->DrawListCacheIdxBuffer);
+    draw_list->VtxBuffer.swap(window->DrawListCacheVtxBuffer);
+    draw_list->_VtxWritePtr = draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size;
+    draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+    draw_list->_VtxCurrentIdx = (unsigned int)draw_list->VtxBuffer.Size - (draw_list->CmdBuffer.Size > 0 ? draw_list->CmdBuffer.back().VtxOffset : 0);
+    if (draw_list->CmdBuffer.Size > 0)
+        memcpy(&draw_list->_CmdHeader, &draw_list->CmdBuffer.back(), sizeof(ImDrawCmdHeader));
+}
+
+// Decide whether the draw list built last frame can be reused as is (ImGuiWindowFlags_CacheDrawList).
+// - The key covers everything other than items which the draw list depends on. Items are assumed to only change
+//   visually on interaction (hovering, clicking, focus, navigation, keyboard input), so the cache is rebuilt on any of those
+//   plus every io.ConfigWindowsCacheMaxFrames frames for contents driven by user data.
+// - On a hit, the cached buffers are moved out of the way while Begin()/End() run on an empty draw list with items skipped,
+//   and restored in End().
+static void ImGui::UpdateWindowDrawListCache(ImGuiWindow* window, const char* name, bool title_bar_is_highlight, bool render_decorations_in_parent)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiID key = ImHashStr(name);
+    key = ImHashData(&window->Pos, sizeof(window->Pos), key);
+    key = ImHashData(&window->Size, sizeof(window->Size), key);
+    key = ImHashData(&window->Scroll, sizeof(window->Scroll), key);
+    key = ImHashData(&window->ContentSize, sizeof(window->ContentSize), key);
+    key = ImHashData(&window->ScrollbarSizes, sizeof(window->ScrollbarSizes), key);
+    key = ImHashData(&window->OuterRectClipped, sizeof(window->OuterRectClipped), key);
+    key = ImHashData(&window->InnerClipRect, sizeof(window->InnerClipRect), key);
+    key = ImHashData(&g.Style, sizeof(g.Style), key);
+    key = ImHashData(&g.IO.DisplaySize, sizeof(g.IO.DisplaySize), key);
+    key = ImHashData(&g.Font, sizeof(g.Font), key);
+    key = ImHashData(&g.FontSize, sizeof(g.FontSize), key);
+    key = ImHashData(&g.Font->ContainerAtlas->TexID, sizeof(ImTextureID), key);
+    key = ImHashData(&g.Font->ContainerAtlas->TexUvScale, sizeof(ImVec2), key); // Texture grown by ImFontAtlasFlags_DynamicGlyphs
+    key = ImHashData(&g.DrawListSharedData.InitialFlags, sizeof(g.DrawListSharedData.InitialFlags), key);
+    const float bg_alpha = (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasBgAlpha) ? g.NextWindowData.BgAlphaVal : -1.0f;
+    const ImGuiID nav_id = (g.NavWindow == window) ? g.NavId : 0;
+    const int state[] = { (int)window->Flags, window->Collapsed, title_bar_is_highlight, render_decorations_in_parent, (int)nav_id, g.NavDisableHighlight };
+    key = ImHashData(&bg_alpha, sizeof(bg_alpha), key);
+    key = ImHashData(state, sizeof(state), key);
+
+    // Anything which may animate or react to inputs within the window prevents caching
+    bool interacting = false;
+    if (g.DimBgRatio > 0.0f || g.DragDropActive || g.LogEnabled || g.NavWindowingTarget != NULL)
+        interacting = true;
+    else if (g.ActiveId != 0 && g.ActiveIdWindow == window)
+        interacting = true;
+    else if (window->Appearing || window->Hidden || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0)
+        interacting = true;
+    else if (g.HoveredWindow == window || g.NavWindow == window)
+        if (g.FrameHadInput || g.NavAnyRequest || (g.HoveredIdPreviousFrame != 0 && g.HoveredIdTimer < IDLE_FRAME_HOVER_SETTLE_TIMER))
+            interacting = true;
+
+    if (window->DrawListCacheValid && window->DrawListCacheKey == key && !interacting && window->DrawListCacheFrames < g.IO.ConfigWindowsCacheMaxFrames)
+    {
+        SwapWindowDrawListCache(window);
+        window->DrawListCacheHit = true;
+        window->DrawListCacheFrames++;
+        g.WindowsCacheHitCount++;
+
+        // Items are skipped: keep the hovered item alive so it stays highlighted in the reused draw list
+        if (g.HoveredWindow == window && g.HoveredIdPreviousFrame != 0 && g.HoveredId == 0)
+            SetHoveredID(g.HoveredIdPreviousFrame);
+    }
+    else
+    {
+        window->DrawListCacheHit = false;
+        window->DrawListCacheValid = !interacting;
+        window->DrawListCacheFrames = 0;
+        window->DrawListCacheKey = key;
+        g.WindowsCacheMissCount++;
+    }
+    window->DrawList->_ResetForNewFrame();
+}
+
 // Push a new Dear ImGui window to add widgets to.
 // - A default window called "Debug" is automatically stacked at the beginning of every frame so you can use widgets without explicitly calling a Begin/End pair.
 // - Begin/End can be called multiple times during the frame with the same window name to append content.
@@ -6030,6 +7088,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     // Parent window is latched only on the first call to Begin() of the frame, so further append-calls can be done from a different window stack
     ImGuiWindow* parent_window_in_stack = g.CurrentWindowStack.empty() ? NULL : g.CurrentWindowStack.back().Window;
     ImGuiWindow* parent_window = first_begin_of_the_frame ? ((flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup)) ? parent_window_in_stack : NULL) : window->ParentWindow;
+
+    // Windows submitted from a window using ImGuiWindowFlags_CacheDrawList would be skipped along with its items: rebuild next frame
+    if (parent_window_in_stack && (parent_window_in_stack->Flags & ImGuiWindowFlags_CacheDrawList))
+        parent_window_in_stack->DrawListCacheValid = false;
     IM_ASSERT(parent_window != NULL || !(flags & ImGuiWindowFlags_ChildWindow));
 
     // We allow window memory to be compacted so recreate the base stack when needed.
@@ -6123,7 +7185,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->HasCloseButton = (p_open != NULL);
         window->ClipRect = ImVec4(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
         window->IDStack.resize(1);
-        window->DrawList->_ResetForNewFrame();
+        if (!(flags & ImGuiWindowFlags_CacheDrawList))
+            window->DrawList->_ResetForNewFrame(); // Otherwise done by UpdateWindowDrawListCache()
         window->DC.CurrentTableIdx = -1;
 
         // Restore buffer capacity when woken from a compacted state, to avoid
@@ -6436,32 +7499,40 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // DRAWING
 
+        // Child windows can render their decoration (bg color, border, scrollbars, etc.) within their parent to save a draw call (since 1.71)
+        // When using overlapping child windows, this will break the assumption that child z-order is mapped to submission order.
+        // FIXME: User code may rely on explicit sorting of overlapping child window and would need to disable this somehow. Please get in contact if you are affected (github #4493)
+        // (Decided before setting up our draw list, which is always empty at this point, so it can be part of ImGuiWindowFlags_CacheDrawList state)
+        bool render_decorations_in_parent = false;
+        if ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip)
+        {
+            // - We test overlap with the previous child window only (testing all would end up being O(log N) not a good investment here)
+            // - We disable this when the parent window has zero vertices, which is a common pattern leading to laying out multiple overlapping childs
+            ImGuiWindow* previous_child = parent_window->DC.ChildWindows.Size >= 2 ? parent_window->DC.ChildWindows[parent_window->DC.ChildWindows.Size - 2] : NULL;
+            bool previous_child_overlapping = previous_child ? previous_child->Rect().Overlaps(window->Rect()) : false;
+            bool parent_is_empty = parent_window->DrawList->VtxBuffer.Size > 0;
+            if (parent_is_empty && !previous_child_overlapping)
+                render_decorations_in_parent = true;
+        }
+        const ImGuiWindow* window_to_highlight = g.NavWindowingTarget ? g.NavWindowingTarget : g.NavWindow;
+        const bool title_bar_is_highlight = want_focus || (window_to_highlight && window->RootWindowForTitleBarHighlight == window_to_highlight->RootWindowForTitleBarHighlight);
+
+        // Reuse draw list of last frame if possible
+        if (flags & ImGuiWindowFlags_CacheDrawList)
+            UpdateWindowDrawListCache(window, name, title_bar_is_highlight, render_decorations_in_parent);
+        else
+            window->DrawListCacheValid = window->DrawListCacheHit = false;
+
         // Setup draw list and outer clipping rectangle
         IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0);
         window->DrawList->PushTextureID(g.Font->ContainerAtlas->TexID);
         PushClipRect(host_rect.Min, host_rect.Max, false);
 
-        // Child windows can render their decoration (bg color, border, scrollbars, etc.) within their parent to save a draw call (since 1.71)
-        // When using overlapping child windows, this will break the assumption that child z-order is mapped to submission order.
-        // FIXME: User code may rely on explicit sorting of overlapping child window and would need to disable this somehow. Please get in contact if you are affected (github #4493)
         {
-            bool render_decorations_in_parent = false;
-            if ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip)
-            {
-                // - We test overlap with the previous child window only (testing all would end up being O(log N) not a good investment here)
-                // - We disable this when the parent window has zero vertices, which is a common pattern leading to laying out multiple overlapping childs
-                ImGuiWindow* previous_child = parent_window->DC.ChildWindows.Size >= 2 ? parent_window->DC.ChildWindows[parent_window->DC.ChildWindows.Size - 2] : NULL;
-                bool previous_child_overlapping = previous_child ? previous_child->Rect().Overlaps(window->Rect()) : false;
-                bool parent_is_empty = parent_window->DrawList->VtxBuffer.Size > 0;
-                if (window->DrawList->CmdBuffer.back().ElemCount == 0 && parent_is_empty && !previous_child_overlapping)
-                    render_decorations_in_parent = true;
-            }
             if (render_decorations_in_parent)
                 window->DrawList = parent_window->DrawList;
 
             // Handle title bar, scrollbar, resize grips and resize borders
-            const ImGuiWindow* window_to_highlight = g.NavWindowingTarget ? g.NavWindowingTarget : g.NavWindow;
-            const bool title_bar_is_highlight = want_focus || (window_to_highlight && window->RootWindowForTitleBarHighlight == window_to_highlight->RootWindowForTitleBarHighlight);
             RenderWindowDecorations(window, title_bar_rect, title_bar_is_highlight, resize_grip_count, resize_grip_col, resize_grip_draw_size);
 
             if (render_decorations_in_parent)
@@ -6575,6 +7646,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     {
         // Append
         SetCurrentWindow(window);
+        if (window->DrawListCacheHit)
+            SwapWindowDrawListCache(window);
     }
 
     // Pull/inherit current state
@@ -6630,6 +7703,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         if (window->Collapsed || !window->Active || hidden_regular)
             if (window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesCannotSkipItems <= 0)
                 skip_items = true;
+        if (window->DrawListCacheHit)
+            skip_items = true;
         window->SkipItems = skip_items;
     }
 
@@ -6658,6 +7733,13 @@ void ImGui::End()
         EndColumns();
     PopClipRect();   // Inner window clip rectangle
 
+    // Restore reused draw list (see UpdateWindowDrawListCache())
+    if (window->DrawListCacheHit)
+    {
+        window->DC.NavLayersActiveMaskNext = window->DC.NavLayersActiveMask;
+        SwapWindowDrawListCache(window);
+    }
+
     // Stop logging
     if (!(window->Flags & ImGuiWindowFlags_ChildWindow))    // FIXME: add more options for scope of logging
         LogFinish();
@@ -7421,6 +8503,14 @@ void ImGui::PushID(const char* str_id_begin, const char* str_id_end)
     window->IDStack.push_back(id);
 }
 
+void ImGui::PushID(ImStrv str_id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiID id = str_id.empty() ? window->GetIDNoKeepAlive("", NULL) : window->GetIDNoKeepAlive(str_id.Begin, str_id.End);
+    window->IDStack.push_back(id);
+}
+
 void ImGui::PushID(const void* ptr_id)
 {
     ImGuiContext& g = *GImGui;
@@ -7479,6 +8569,12 @@ ImGuiID ImGui::GetID(const char* str_id_begin, const char* str_id_end)
     return window->GetID(str_id_begin, str_id_end);
 }
 
+ImGuiID ImGui::GetID(ImStrv str_id)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    return window->GetID(str_id);
+}
+
 ImGuiID ImGui::GetID(const void* ptr_id)
 {
     ImGuiWindow* window = GImGui->CurrentWindow;
@@ -7961,6 +9057,8 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     IM_ASSERT((g.FrameCount == 0 || g.FrameCountEnded == g.FrameCount)  && "Forgot to call Render() or EndFrame() at the end of the previous frame?");
     IM_ASSERT(g.IO.DisplaySize.x >= 0.0f && g.IO.DisplaySize.y >= 0.0f  && "Invalid DisplaySize value!");
     IM_ASSERT(g.IO.Fonts->IsBuilt()                                     && "Font Atlas not built! Make sure you called ImGui_ImplXXXX_NewFrame() function for renderer backend, which should call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8()");
+    IM_ASSERT((!(g.IO.Fonts->Flags & ImFontAtlasFlags_DynamicGlyphs) || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates)) && "ImFontAtlasFlags_DynamicGlyphs requires a renderer backend uploading io.Fonts->TexDirtyRects[]!");
+    IM_ASSERT((!(g.IO.Fonts->Flags & ImFontAtlasFlags_SignedDistanceField) || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfFonts)) && "ImFontAtlasFlags_SignedDistanceField requires a renderer backend with a distance field shader!");
     IM_ASSERT(g.Style.CurveTessellationTol > 0.0f                       && "Invalid style setting!");
     IM_ASSERT(g.Style.CircleTessellationMaxError  > 0.0f                && "Invalid style setting!");
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting!"); // Allows us to avoid a few clamps in color computations
@@ -11500,9 +12598,50 @@ void ImGui::LogButtons()
 // - LoadIniSettingsFromMemory()
 // - SaveIniSettingsToDisk()
 // - SaveIniSettingsToMemory()
+// - SettingsBeginWriteEntry() [Internal]
+// - SettingsEndWriteEntry() [Internal]
 // - WindowSettingsHandler_***() [Internal]
 //-----------------------------------------------------------------------------
 
+#ifdef IMGUI_ENABLE_THREADED_INI_SAVE
+// Background write of the .ini file started by SaveIniSettingsToDisk().
+// The worker only writes and closes a file opened by the main thread, so it never calls into ImGui or its allocators.
+// The temporary file is renamed over the destination by the main thread once the write completed (see SettingsSaveJobFinish()).
+struct ImGuiSettingsSaveJob
+{
+    std::thread         Thread;
+    std::atomic<bool>   Done;
+    bool                WriteOk;
+    ImFileHandle        File;
+    ImGuiTextBuffer     Data;
+    ImGuiTextBuffer     Filename;
+    ImGuiTextBuffer     TempFilename;
+
+    ImGuiSettingsSaveJob() : Done(false) { WriteOk = false; File = NULL; }
+};
+
+static void SettingsSaveJobThreadFunc(ImGuiSettingsSaveJob* job)
+{
+    const ImU64 data_size = (ImU64)job->Data.size();
+    bool ok = ImFileWrite(job->Data.c_str(), sizeof(char), data_size, job->File) == data_size;
+    ok &= ImFileClose(job->File);
+    job->File = NULL;
+    job->WriteOk = ok;
+    job->Done.store(true, std::memory_order_release);
+}
+
+// Wait for the pending write (if any) and move the written file in place
+static void SettingsSaveJobFinish(ImGuiContext* ctx)
+{
+    ImGuiSettingsSaveJob* job = ctx->SettingsSaveJob;
+    if (job == NULL || !job->Thread.joinable())
+        return;
+    job->Thread.join();
+    if (job->WriteOk)
+        ImFileRename(job->TempFilename.c_str(), job->Filename.c_str());
+}
+#endif
+
 // Called by NewFrame()
 void ImGui::UpdateSettings()
 {
@@ -11516,6 +12655,12 @@ void ImGui::UpdateSettings()
         g.SettingsLoaded = true;
     }
 
+#ifdef IMGUI_ENABLE_THREADED_INI_SAVE
+    // Complete background write
+    if (g.SettingsSaveJob && g.SettingsSaveJob->Done.load(std::memory_order_acquire))
+        SettingsSaveJobFinish(&g);
+#endif
+
     // Save settings (with a delay after the last modification, so we don't spam disk too much)
     if (g.SettingsDirtyTimer > 0.0f)
     {
@@ -11564,6 +12709,7 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
+    g.SettingsWindowsById.SetInt(settings->ID, g.SettingsWindows.offset_from_ptr(settings));
 
     return settings;
 }
@@ -11571,10 +12717,11 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 ImGuiWindowSettings* ImGui::FindWindowSettings(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsWindowsById.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(offset);
+    return (settings->ID == id) ? settings : NULL;
 }
 
 ImGuiWindowSettings* ImGui::FindOrCreateWindowSettings(const char* name)
@@ -11598,6 +12745,7 @@ void ImGui::ClearIniSettings()
 {
     ImGuiContext& g = *GImGui;
     g.SettingsIniData.clear();
+    g.SettingsIniDataIsSaved = false;
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
         if (g.SettingsHandlers[handler_n].ClearAllFn)
             g.SettingsHandlers[handler_n].ClearAllFn(&g, &g.SettingsHandlers[handler_n]);
@@ -11605,6 +12753,9 @@ void ImGui::ClearIniSettings()
 
 void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
 {
+#ifdef IMGUI_ENABLE_THREADED_INI_SAVE
+    SettingsSaveJobFinish(GImGui);
+#endif
     size_t file_data_size = 0;
     char* file_data = (char*)ImFileLoadToMemory(ini_filename, "rb", &file_data_size);
     if (!file_data)
@@ -11626,6 +12777,7 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
     if (ini_size == 0)
         ini_size = strlen(ini_data);
     g.SettingsIniData.Buf.resize((int)ini_size + 1);
+    g.SettingsIniDataIsSaved = false;
     char* const buf = g.SettingsIniData.Buf.Data;
     char* const buf_end = buf + ini_size;
     memcpy(buf, ini_data, ini_size);
@@ -11693,36 +12845,100 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
+#ifdef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
     ImFileHandle f = ImFileOpen(ini_filename, "wt");
     if (!f)
         return;
     ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
     ImFileClose(f);
+#else
+    // Write to a temporary file and rename it over the destination,
+    // so a crash or a full disk in the middle of the write doesn't leave a truncated .ini file behind.
+#ifdef IMGUI_ENABLE_THREADED_INI_SAVE
+    SettingsSaveJobFinish(&g);
+    if (g.SettingsSaveJob == NULL)
+        g.SettingsSaveJob = IM_NEW(ImGuiSettingsSaveJob)();
+    ImGuiSettingsSaveJob* job = g.SettingsSaveJob;
+    job->Filename.Buf.resize(0);
+    job->Filename.append(ini_filename);
+    job->TempFilename.Buf.resize(0);
+    job->TempFilename.appendf("%s.tmp", ini_filename);
+    ImFileHandle f = ImFileOpen(job->TempFilename.c_str(), "wt");
+    if (!f)
+        return;
+    job->Data.Buf.resize(0);
+    job->Data.append(ini_data, ini_data + ini_data_size);
+    job->File = f;
+    job->WriteOk = false;
+    job->Done.store(false, std::memory_order_relaxed);
+    job->Thread = std::thread(SettingsSaveJobThreadFunc, job);
+#else
+    ImGuiTextBuffer temp_filename;
+    temp_filename.appendf("%s.tmp", ini_filename);
+    ImFileHandle f = ImFileOpen(temp_filename.c_str(), "wt");
+    if (!f)
+        return;
+    bool ok = ImFileWrite(ini_data, sizeof(char), ini_data_size, f) == ini_data_size;
+    ok &= ImFileClose(f);
+    if (ok)
+        ImFileRename(temp_filename.c_str(), ini_filename);
+#endif
+#endif
 }
 
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
+// The text of the previous call is kept in SettingsIniDataPrev, so the built-in handlers only format the entries which changed since.
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
     ImGuiContext& g = *GImGui;
     g.SettingsDirtyTimer = 0.0f;
+    g.SettingsIniDataPrev.Buf.swap(g.SettingsIniData.Buf);
+    if (!g.SettingsIniDataIsSaved)
+        g.SettingsIniDataPrev.Buf.resize(0); // Data was loaded or cleared since: nothing to reuse
     g.SettingsIniData.Buf.resize(0);
+    g.SettingsIniData.Buf.reserve(g.SettingsIniDataPrev.Buf.Size);
     g.SettingsIniData.Buf.push_back(0);
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
     {
         ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
         handler->WriteAllFn(&g, handler, &g.SettingsIniData);
     }
+    g.SettingsIniDataIsSaved = true;
     if (out_size)
         *out_size = (size_t)g.SettingsIniData.size();
     return g.SettingsIniData.c_str();
 }
 
+// Helpers for WriteAllFn handlers to cache the text of each entry across calls to SaveIniSettingsToMemory().
+// - 'text_offset'/'text_size' are stored in the entry, set 'text_size' to 0 whenever the entry data changes.
+// - SettingsBeginWriteEntry() copies the text written by the previous save and returns false when it is still valid,
+//   otherwise returns true and the caller formats the entry, then calls SettingsEndWriteEntry().
+bool ImGui::SettingsBeginWriteEntry(ImGuiTextBuffer* buf, int* text_offset, int* text_size)
+{
+    ImGuiContext& g = *GImGui;
+    const int prev_offset = *text_offset;
+    const int prev_size = *text_size;
+    *text_offset = buf->size();
+    if (buf != &g.SettingsIniData || prev_size <= 0 || prev_offset + prev_size > g.SettingsIniDataPrev.size())
+        return true;
+    buf->append(g.SettingsIniDataPrev.begin() + prev_offset, g.SettingsIniDataPrev.begin() + prev_offset + prev_size);
+    return false;
+}
+
+void ImGui::SettingsEndWriteEntry(ImGuiTextBuffer* buf, int* text_offset, int* text_size)
+{
+    // Text written to another buffer (e.g. by a direct call to WriteAllFn) can't be reused
+    ImGuiContext& g = *GImGui;
+    *text_size = (buf == &g.SettingsIniData) ? buf->size() - *text_offset : 0;
+}
+
 static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
 {
     ImGuiContext& g = *ctx;
     for (int i = 0; i != g.Windows.Size; i++)
         g.Windows[i]->SettingsOffset = -1;
     g.SettingsWindows.clear();
+    g.SettingsWindowsById.Clear();
 }
 
 static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
@@ -11776,8 +12992,12 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
         }
         IM_ASSERT(settings->ID == window->ID);
-        settings->Pos = ImVec2ih(window->Pos);
-        settings->Size = ImVec2ih(window->SizeFull);
+        const ImVec2ih pos(window->Pos);
+        const ImVec2ih size(window->SizeFull);
+        if (settings->Pos.x != pos.x || settings->Pos.y != pos.y || settings->Size.x != size.x || settings->Size.y != size.y || settings->Collapsed != window->Collapsed)
+            settings->IniTextSize = 0;
+        settings->Pos = pos;
+        settings->Size = size;
 
         settings->Collapsed = window->Collapsed;
     }
@@ -11786,12 +13006,15 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
+        if (!ImGui::SettingsBeginWriteEntry(buf, &settings->IniTextOffset, &settings->IniTextSize))
+            continue;
         const char* settings_name = settings->GetName();
         buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
         buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
         buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
         buf->appendf("Collapsed=%d\n", settings->Collapsed);
         buf->append("\n");
+        ImGui::SettingsEndWriteEntry(buf, &settings->IniTextOffset, &settings->IniTextSize);
     }
 }
 
@@ -12124,6 +13347,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d active allocations", io.MetricsRenderWindows, io.MetricsActiveAllocations);
+    Text("%d cached window draw lists reused, %d rebuilt", io.MetricsWindowsCacheHits, io.MetricsWindowsCacheMisses);
+    Text("%d cached text layouts reused, %d computed", io.MetricsTextLayoutCacheHits, io.MetricsTextLayoutCacheMisses);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -12544,7 +13769,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
     int cmd_count = draw_list->CmdBuffer.Size;
     if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxChunksSize + draw_list->IdxBuffer.Size, cmd_count);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -12563,6 +13788,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
     if (window && !window->WasActive)
         TextDisabled("Warning: owning Window is inactive. This DrawList is not being rendered!");
 
+    ImVector<ImDrawIdx> idx_temp_buffer; // Index data linked by ImDrawListSplitter::Merge() is flattened into this
     for (const ImDrawCmd* pcmd = draw_list->CmdBuffer.Data; pcmd < draw_list->CmdBuffer.Data + cmd_count; pcmd++)
     {
         if (pcmd->UserCallback)
@@ -12583,7 +13809,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
 
         // Calculate approximate coverage area (touched pixel count)
         // This will be in pixels squared as long there's no post-scaling happening to the renderer output.
-        const ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
+        const ImDrawIdx* idx_buffer = (draw_list->IdxChunksSize + draw_list->IdxBuffer.Size > 0) ? draw_list->_GetFlatIdxBuffer(&idx_temp_buffer) : NULL;
         const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
         float total_area = 0.0f;
         for (unsigned int idx_n = pcmd->IdxOffset; idx_n < pcmd->IdxOffset + pcmd->ElemCount; )
@@ -12640,9 +13866,12 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
     ImRect vtxs_rect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
     ImDrawListFlags backup_flags = out_draw_list->Flags;
     out_draw_list->Flags &= ~ImDrawListFlags_AntiAliasedLines; // Disable AA on triangle outlines is more readable for very large and thin triangles.
+    ImVector<ImDrawIdx> idx_temp_buffer; // Index data linked by ImDrawListSplitter::Merge() is flattened into this
+    if (draw_list->IdxChunks.Size > 0)
+        draw_list->_GetFlatIdxBuffer(&idx_temp_buffer);
     for (unsigned int idx_n = draw_cmd->IdxOffset, idx_end = draw_cmd->IdxOffset + draw_cmd->ElemCount; idx_n < idx_end; )
     {
-        ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL; // We don't hold on those pointers past iterations as ->AddPolyline() may invalidate them if out_draw_list==draw_list
+        const ImDrawIdx* idx_buffer = (draw_list->IdxChunks.Size > 0) ? idx_temp_buffer.Data : (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL; // We don't hold on those pointers past iterations as ->AddPolyline() may invalidate them if out_draw_list==draw_list
         ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + draw_cmd->VtxOffset;
 
         ImVec2 triangle[3];
@@ -12759,8 +13988,13 @@ void ImGui::DebugNodeFont(ImFont* font)
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
+#ifdef IMGUI_USE_HASHED_STORAGE
+    if (!TreeNode(label, "%s: %d entries, %d bytes (+%d bytes index)", label, storage->Data.Size, storage->Data.size_in_bytes(), storage->Index.size_in_bytes()))
+        return;
+#else
     if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
         return;
+#endif
     for (int n = 0; n < storage->Data.Size; n++)
     {
         const ImGuiStorage::ImGuiStoragePair& p = storage->Data[n];
@@ -31,7 +31,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiListClipperHeightIndex, ImGuiTableSortIndex, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -150,6 +150,7 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeightIndex; // Helper to store heights of a list of items of varying heights, for ImGuiListClipper
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformImeData;        // Platform IME data for io.SetPlatformImeDataFn() function.
@@ -158,6 +159,7 @@ struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
+struct ImGuiTableSortIndex;         // Helper to keep the rows of a table sorted according to its sorting specifications
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
@@ -242,6 +244,7 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef int     (*ImGuiTableSortCompareFunc)(int row_a, int row_b, const ImGuiTableColumnSortSpecs* sort_spec, void* user_data); // Function signature for ImGuiTableSortIndex: compare two rows on one column, ascending (<0, 0 or >0)
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -268,6 +271,23 @@ struct ImVec4
     IM_VEC4_CLASS_EXTRA     // Define additional constructors and implicit cast operators in imconfig.h to convert back and forth between your math types and ImVec4.
 #endif
 };
+
+// ImStrv: String view (begin/end pair) accepted by the label-taking widgets, so the length is known without scanning for a zero terminator.
+// Implicitly constructible from a zero-terminated string. The text doesn't need to be zero-terminated when End is set.
+// Consider using IM_STRV_CLASS_EXTRA to create implicit cast from your string types (e.g. std::string_view).
+struct ImStrv
+{
+    const char*     Begin;
+    const char*     End;
+    ImStrv()                                { Begin = End = NULL; }
+    ImStrv(const char* b)                   { Begin = b; End = b ? b + strlen(b) : NULL; }
+    ImStrv(const char* b, const char* e)    { Begin = b; End = e ? e : b ? b + strlen(b) : NULL; }
+    size_t          length() const          { return (size_t)(End - Begin); }
+    bool            empty() const           { return Begin == End; }
+#ifdef IM_STRV_CLASS_EXTRA
+    IM_STRV_CLASS_EXTRA     // Define additional constructors in imconfig.h to convert your string types to ImStrv.
+#endif
+};
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 //-----------------------------------------------------------------------------
@@ -293,6 +313,8 @@ namespace ImGui
     IMGUI_API void          EndFrame();                                 // ends the Dear ImGui frame. automatically called by Render(). If you don't need to render data (skipping rendering) you may call EndFrame() without Render()... but you'll have wasted CPU already! If you don't need to render, better to not create any windows and not call NewFrame() at all!
     IMGUI_API void          Render();                                   // ends the Dear ImGui frame, finalize the draw data. You can then get call GetDrawData().
     IMGUI_API ImDrawData*   GetDrawData();                              // valid after Render() and until the next call to NewFrame(). this is what you have to render.
+    IMGUI_API bool          IsLastFrameClean();                         // was the last frame "clean": no input, no active item, animation or timer, and same draw data as the frame before?
+    IMGUI_API bool          CanSkipFrame();                             // call before NewFrame(): true if the last frame was clean and no input was received since. You may then skip NewFrame()/Render() and render GetDrawData() again. Returns false at least once every io.ConfigIdleFramesMaxSkip calls.
 
     // Demo, Debug, Information
     IMGUI_API void          ShowDemoWindow(bool* p_open = NULL);        // create Demo window. demonstrate most ImGui features. call this to learn about the library! try to make it always available in your application!
@@ -464,15 +486,18 @@ namespace ImGui
     //   whereas "str_id" denote a string that is only used as an ID and not normally displayed.
     IMGUI_API void          PushID(const char* str_id);                                     // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(const char* str_id_begin, const char* str_id_end);       // push string into the ID stack (will hash string).
+    IMGUI_API void          PushID(ImStrv str_id);                                          // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(const void* ptr_id);                                     // push pointer into the ID stack (will hash pointer).
     IMGUI_API void          PushID(int int_id);                                             // push integer into the ID stack (will hash integer).
     IMGUI_API void          PopID();                                                        // pop from the ID stack.
     IMGUI_API ImGuiID       GetID(const char* str_id);                                      // calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
+    IMGUI_API ImGuiID       GetID(ImStrv str_id);
     IMGUI_API ImGuiID       GetID(const char* str_id_begin, const char* str_id_end);
     IMGUI_API ImGuiID       GetID(const void* ptr_id);
 
     // Widgets: Text
     IMGUI_API void          TextUnformatted(const char* text, const char* text_end = NULL); // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
+    IMGUI_API void          TextUnformatted(ImStrv text);
     IMGUI_API void          Text(const char* fmt, ...)                                      IM_FMTARGS(1); // formatted text
     IMGUI_API void          TextV(const char* fmt, va_list args)                            IM_FMTLIST(1);
     IMGUI_API void          TextColored(const ImVec4& col, const char* fmt, ...)            IM_FMTARGS(2); // shortcut for PushStyleColor(ImGuiCol_Text, col); Text(fmt, ...); PopStyleColor();
@@ -490,15 +515,19 @@ namespace ImGui
     // - Most widgets return true when the value has been changed or when pressed/selected
     // - You may also use one of the many IsItemXXX functions (e.g. IsItemActive, IsItemHovered, etc.) to query widget state.
     IMGUI_API bool          Button(const char* label, const ImVec2& size = ImVec2(0, 0));   // button
+    IMGUI_API bool          Button(ImStrv label, const ImVec2& size = ImVec2(0, 0));
     IMGUI_API bool          SmallButton(const char* label);                                 // button with FramePadding=(0,0) to easily embed within text
+    IMGUI_API bool          SmallButton(ImStrv label);
     IMGUI_API bool          InvisibleButton(const char* str_id, const ImVec2& size, ImGuiButtonFlags flags = 0); // flexible button behavior without the visuals, frequently useful to build custom behaviors using the public api (along with IsItemActive, IsItemHovered, etc.)
     IMGUI_API bool          ArrowButton(const char* str_id, ImGuiDir dir);                  // square button with an arrow shape
     IMGUI_API void          Image(ImTextureID user_texture_id, const ImVec2& size, const ImVec2& uv0 = ImVec2(0, 0), const ImVec2& uv1 = ImVec2(1,1), const ImVec4& tint_col = ImVec4(1,1,1,1), const ImVec4& border_col = ImVec4(0,0,0,0));
     IMGUI_API bool          ImageButton(ImTextureID user_texture_id, const ImVec2& size, const ImVec2& uv0 = ImVec2(0, 0),  const ImVec2& uv1 = ImVec2(1,1), int frame_padding = -1, const ImVec4& bg_col = ImVec4(0,0,0,0), const ImVec4& tint_col = ImVec4(1,1,1,1));    // <0 frame_padding uses default frame padding settings. 0 for no padding
     IMGUI_API bool          Checkbox(const char* label, bool* v);
+    IMGUI_API bool          Checkbox(ImStrv label, bool* v);
     IMGUI_API bool          CheckboxFlags(const char* label, int* flags, int flags_value);
     IMGUI_API bool          CheckboxFlags(const char* label, unsigned int* flags, unsigned int flags_value);
     IMGUI_API bool          RadioButton(const char* label, bool active);                    // use with e.g. if (RadioButton("one", my_value==1)) { my_value = 1; }
+    IMGUI_API bool          RadioButton(ImStrv label, bool active);
     IMGUI_API bool          RadioButton(const char* label, int* v, int v_button);           // shortcut to handle the above pattern when value is an integer
     IMGUI_API void          ProgressBar(float fraction, const ImVec2& size_arg = ImVec2(-FLT_MIN, 0), const char* overlay = NULL);
     IMGUI_API void          Bullet();                                                       // draw a small circle + keep the cursor on the same line. advance cursor x position by GetTreeNodeToLabelSpacing(), same distance that TreeNode() uses
@@ -589,6 +618,7 @@ namespace ImGui
     // Widgets: Trees
     // - TreeNode functions return true when the node is open, in which case you need to also call TreePop() when you are finished displaying the tree node contents.
     IMGUI_API bool          TreeNode(const char* label);
+    IMGUI_API bool          TreeNode(ImStrv label);
     IMGUI_API bool          TreeNode(const char* str_id, const char* fmt, ...) IM_FMTARGS(2);   // helper variation to easily decorelate the id from the displayed string. Read the FAQ about why and how to use ID. to align arbitrary text at the same level as a TreeNode() you can use Bullet().
     IMGUI_API bool          TreeNode(const void* ptr_id, const char* fmt, ...) IM_FMTARGS(2);   // "
     IMGUI_API bool          TreeNodeV(const char* str_id, const char* fmt, va_list args) IM_FMTLIST(2);
@@ -604,6 +634,8 @@ namespace ImGui
     IMGUI_API float         GetTreeNodeToLabelSpacing();                                        // horizontal distance preceding label when using TreeNode*() or Bullet() == (g.FontSize + style.FramePadding.x*2) for a regular unframed TreeNode
     IMGUI_API bool          CollapsingHeader(const char* label, ImGuiTreeNodeFlags flags = 0);  // if returning 'true' the header is open. doesn't indent nor push on ID stack. user doesn't have to call TreePop().
     IMGUI_API bool          CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFlags flags = 0); // when 'p_visible != NULL': if '*p_visible==true' display an additional small close button on upper right of the header which will set the bool to false when clicked, if '*p_visible==false' don't display the header.
+    IMGUI_API bool          CollapsingHeader(ImStrv label, ImGuiTreeNodeFlags flags = 0);
+    IMGUI_API bool          CollapsingHeader(ImStrv label, bool* p_visible, ImGuiTreeNodeFlags flags = 0);
     IMGUI_API void          SetNextItemOpen(bool is_open, ImGuiCond cond = 0);                  // set next TreeNode/CollapsingHeader open state.
 
     // Widgets: Selectables
@@ -611,6 +643,8 @@ namespace ImGui
     // - Neighbors selectable extend their highlight bounds in order to leave no gap between them. This is so a series of selected Selectable appear contiguous.
     IMGUI_API bool          Selectable(const char* label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0)); // "bool selected" carry the selection state (read-only). Selectable() is clicked is returns true so you can modify your selection state. size.x==0.0: use remaining width, size.x>0.0: specify width. size.y==0.0: use label height, size.y>0.0: specify height
     IMGUI_API bool          Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));      // "bool* p_selected" point to the selection state (read-write), as a convenient helper.
+    IMGUI_API bool          Selectable(ImStrv label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));
+    IMGUI_API bool          Selectable(ImStrv label, bool* p_selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));
 
     // Widgets: List Boxes
     // - This is essentially a thin wrapper to using BeginChild/EndChild with some stylistic changes.
@@ -650,6 +684,8 @@ namespace ImGui
     IMGUI_API void          EndMenu();                                                          // only call EndMenu() if BeginMenu() returns true!
     IMGUI_API bool          MenuItem(const char* label, const char* shortcut = NULL, bool selected = false, bool enabled = true);  // return true when activated.
     IMGUI_API bool          MenuItem(const char* label, const char* shortcut, bool* p_selected, bool enabled = true);              // return true when activated + toggle (*p_selected) if p_selected != NULL
+    IMGUI_API bool          MenuItem(ImStrv label, ImStrv shortcut = ImStrv(), bool selected = false, bool enabled = true);
+    IMGUI_API bool          MenuItem(ImStrv label, ImStrv shortcut, bool* p_selected, bool enabled = true);
 
     // Tooltips
     // - Tooltip are windows following the mouse. They do not take focus away.
@@ -865,6 +901,7 @@ namespace ImGui
 
     // Text Utilities
     IMGUI_API ImVec2        CalcTextSize(const char* text, const char* text_end = NULL, bool hide_text_after_double_hash = false, float wrap_width = -1.0f);
+    IMGUI_API ImVec2        CalcTextSize(ImStrv text, bool hide_text_after_double_hash = false, float wrap_width = -1.0f);
 
     // Color Utilities
     IMGUI_API ImVec4        ColorConvertU32ToFloat4(ImU32 in);
@@ -963,6 +1000,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 18,  // No gamepad/keyboard navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 19,  // No focusing toward this window with gamepad/keyboard navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 20,  // Display a dot next to the title. When used in a tab/docking context, tab is selected when clicking the X + closure is not assumed (will wait for user to stop submitting the tab). Otherwise closure is assumed when pressing the X, so if you keep submitting the tab may reappear at end of tab bar.
+    ImGuiWindowFlags_CacheDrawList          = 1 << 22,  // Reuse the window draw list of last frame while nothing it depends on changed (position, size, scroll, style, focus, interactions). Begin() then returns false and items are skipped. Contents driven by your own data are only refreshed every io.ConfigWindowsCacheMaxFrames frames. Not for windows submitting child windows, popups or tooltips.
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -1519,7 +1557,10 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasGamepad            = 1 << 0,   // Backend Platform supports gamepad and currently has one connected.
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
-    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3    // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 4,   // Backend Renderer uploads ImFontAtlas::TexDirtyRects[] and re-creates the font texture when the atlas is resized. Required by ImFontAtlasFlags_DynamicGlyphs.
+    ImGuiBackendFlags_RendererHasSdfFonts   = 1 << 5,   // Backend Renderer renders draw commands using the font texture with a distance field shader when the atlas is built with ImFontAtlasFlags_SignedDistanceField.
+    ImGuiBackendFlags_RendererHasIdxChunks  = 1 << 6    // Backend Renderer reads ImDrawList::IdxChunks[] before ImDrawList::IdxBuffer[]. This lets ImDrawListSplitter::Merge() (columns, tables) link index buffers instead of copying them.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1874,6 +1915,7 @@ struct ImGuiStyle
     bool        AntiAliasedLines;           // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedLinesUseTex;     // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedFill;            // Enable anti-aliased edges around filled shapes (rounded rectangles, circles, etc.). Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
+    bool        JoinedLines;                // Join segments of lines/borders drawn without anti-aliasing, sharing their edge vertices with miter joins (about half the vertices, no gaps at corners). Latched at the beginning of the frame (copied to ImDrawList).
     float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     float       CircleTessellationMaxError; // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
     ImVec4      Colors[ImGuiCol_COUNT];
@@ -1934,6 +1976,8 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    int         ConfigIdleFramesMaxSkip;        // = 30             // Maximum number of consecutive frames CanSkipFrame() can skip, so contents driven by your own code (e.g. values read from your application) keep being refreshed. Set to 0 to disable frame skipping.
+    int         ConfigWindowsCacheMaxFrames;    // = 30             // Maximum number of consecutive frames a window using ImGuiWindowFlags_CacheDrawList reuses its draw list, so contents driven by your own code keep being refreshed.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1999,6 +2043,10 @@ struct ImGuiIO
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
+    int         MetricsWindowsCacheHits;            // Number of windows using ImGuiWindowFlags_CacheDrawList which reused their draw list
+    int         MetricsWindowsCacheMisses;          // Number of windows using ImGuiWindowFlags_CacheDrawList which rebuilt their draw list
+    int         MetricsTextLayoutCacheHits;         // Number of CalcTextSize() results and wrapped text lines reused from the text layout cache
+    int         MetricsTextLayoutCacheMisses;       // Number of CalcTextSize() results and wrapped text lines computed and stored in the text layout cache
     int         MetricsActiveAllocations;           // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
@@ -2154,7 +2202,7 @@ struct ImGuiTableSortSpecs
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiListClipperHeightIndex, ImGuiTableSortIndex, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2242,11 +2290,19 @@ struct ImGuiStorage
     };
 
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    ImVector<int>                   Index;      // Open-addressing table of (index into Data + 1), 0 for an empty slot. Only allocated once Data grows past a few entries.
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+    // - With IMGUI_USE_HASHED_STORAGE: pairs are kept in insertion order and indexed by a hash table, so both queries and insertions are O(1).
+#ifdef IMGUI_USE_HASHED_STORAGE
+    void                Clear() { Data.clear(); Index.clear(); }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2269,6 +2325,7 @@ struct ImGuiStorage
     IMGUI_API void      SetAllInt(int val);
 
     // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // (with IMGUI_USE_HASHED_STORAGE this also rebuilds the index, so it needs to be called after pushing into Data directly)
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -2292,6 +2349,11 @@ struct ImGuiStorage
 // - Clipper calculate the actual range of elements to display based on the current clipping rectangle, position the cursor before the first visible element.
 // - User code submit visible elements.
 // - The clipper also handles various subtleties related to keyboard/gamepad navigation, wrapping etc.
+// For items of varying heights, keep a ImGuiListClipperHeightIndex alive with your list and pass it to Begin():
+//   static ImGuiListClipperHeightIndex heights;
+//   clipper.Begin(1000, &heights);
+// The clipper then steps through visible items one at a time, measures and records their height in the index.
+// Items which have never been displayed are assumed to be heights.DefaultHeight high.
 struct ImGuiListClipper
 {
     int             DisplayStart;       // First item to display, updated by each call to Step()
@@ -2300,12 +2362,15 @@ struct ImGuiListClipper
     float           ItemsHeight;        // [Internal] Height of item after a first step and item submission can calculate it
     float           StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
     void*           TempData;           // [Internal] Internal data
+    ImGuiListClipperHeightIndex* HeightIndex; // [Internal] Heights of items, when they vary (set by Begin())
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step)
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
+    // height_index: Persistent heights of items of varying heights (items_count can't be INT_MAX).
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  Begin(int items_count, ImGuiListClipperHeightIndex* height_index);
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2317,6 +2382,56 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Heights of a list of items, for ImGuiListClipper::Begin() with items of varying heights.
+// Stored as a Fenwick tree (binary indexed tree) of the heights so that updating the height of an item,
+// getting the position of an item and finding the item at a position are all O(log N).
+// Heights are kept by index when the number of items changes: call SetHeight() or Clear() if you insert/remove items elsewhere than at the end.
+struct ImGuiListClipperHeightIndex
+{
+    ImVector<float>     Heights;        // Height of each item, including item spacing (DefaultHeight until measured)
+    ImVector<double>    Tree;           // Tree[n-1] = sum of Heights[n-(n&-n) .. n-1]
+    float               DefaultHeight;  // Height of items not measured yet. If <= 0.0f, ImGuiListClipper::Begin() sets it to GetTextLineHeightWithSpacing().
+
+    ImGuiListClipperHeightIndex()       { DefaultHeight = 0.0f; }
+    void                Clear()         { Heights.clear(); Tree.clear(); }
+    int                 GetItemsCount() const       { return Heights.Size; }
+    float               GetHeight(int item_n) const { return Heights[item_n]; }
+    double              GetTotalHeight() const      { return GetOffset(Heights.Size); }
+    IMGUI_API void      Resize(int items_count);                // New items get DefaultHeight. O(log N) per added item.
+    IMGUI_API void      SetHeight(int item_n, float height);    // O(log N)
+    IMGUI_API double    GetOffset(int item_n) const;            // Sum of the heights of items [0, item_n). O(log N)
+    IMGUI_API int       FindItemAtOffset(double offset) const;  // Item covering 'offset', clamped to [0, items_count - 1]. O(log N)
+};
+
+// Helper: Sorted order of the rows of a table, maintained from the table sort specs and a compare function.
+// Instead of sorting your data when SpecsDirty is set, keep a ImGuiTableSortIndex alive with your data and call Update() after TableGetSortSpecs():
+//   static ImGuiTableSortIndex sort_index;
+//   sort_index.CompareFunc = MyCompareRows;                   // int MyCompareRows(int row_a, int row_b, const ImGuiTableColumnSortSpecs* sort_spec, void* user_data)
+//   sort_index.Update(ImGui::TableGetSortSpecs(), rows_count); // Clears SpecsDirty
+//   for (int display_n = 0; display_n < sort_index.Rows.Size; display_n++)
+//       DisplayMyRow(sort_index.Rows[display_n]);
+// - The compare function compares two rows on a single column in ascending order: the index applies SortDirection and walks multiple specs.
+//   Rows which compare equal on all specs are kept in increasing row index order (the sort is stable).
+// - Rows are only fully sorted again when the sort specs change. When a few rows change or are appended, call MarkRowDirty() for each of them:
+//   Update() will then move them to their new position in O(N + K log K), instead of O(N log N) for a full sort.
+// - With IMGUI_ENABLE_THREADED_TABLE_SORT, full sorts of large row counts are split between ThreadsCount threads. The result is the same.
+struct ImGuiTableSortIndex
+{
+    ImVector<int>               Rows;           // Rows[display_n] = index of the row in your data, in sorted order
+    ImGuiTableSortCompareFunc   CompareFunc;    // Compare two rows on one column (ascending)
+    void*                       UserData;       // Passed to CompareFunc
+    int                         ThreadsCount;   // Number of threads used for full sorts, the calling thread included. Defaults to 0 (one per hardware thread). Requires IMGUI_ENABLE_THREADED_TABLE_SORT, ignored otherwise.
+    ImVector<ImGuiTableColumnSortSpecs> Specs;  // [Internal] Sort specs the rows are sorted with
+    ImVector<int>               DirtyRows;      // [Internal] Rows marked with MarkRowDirty() since the last Update()
+    ImVector<int>               TempRows;       // [Internal]
+    bool                        NeedFullSort;   // [Internal]
+
+    ImGuiTableSortIndex()       { CompareFunc = NULL; UserData = NULL; ThreadsCount = 0; NeedFullSort = true; }
+    void                        MarkRowDirty(int row_n) { DirtyRows.push_back(row_n); }   // Data of this row changed
+    void                        MarkAllDirty()          { NeedFullSort = true; }          // Data of many rows changed, or rows were inserted/removed elsewhere than at the end
+    IMGUI_API bool              Update(ImGuiTableSortSpecs* sort_specs, int rows_count);  // sort_specs may be NULL (unsorted). Return true if Rows changed.
+};
+
 // Helpers macros to generate 32-bit encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -2482,7 +2597,10 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLines        = 1 << 0,  // Enable anti-aliased lines/borders (*2 the number of triangles for 1.0f wide line or lines thin enough to be drawn using textures, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering.
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
-    ImDrawListFlags_AllowVtxOffset          = 1 << 3   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_JoinedLines             = 1 << 4,  // Non anti-aliased lines/borders: consecutive segments share their edge vertices with miter joins (2 vertices per point instead of 4 per segment). Sharp corners use bevel joins.
+    ImDrawListFlags_JoinedLinesBevel        = 1 << 5,  // Non anti-aliased lines/borders: use bevel joins for all corners (with ImDrawListFlags_JoinedLines).
+    ImDrawListFlags_AllowIdxChunks          = 1 << 6   // Can output index data in IdxChunks[] + IdxBuffer[]. Set when 'ImGuiBackendFlags_RendererHasIdxChunks' is enabled.
 };
 
 // Draw command list
@@ -2501,6 +2619,8 @@ struct ImDrawList
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
+    ImVector<ImVector<ImDrawIdx> > IdxChunks;   // Index buffers preceding IdxBuffer[]. Only used with ImDrawListFlags_AllowIdxChunks, in which case the index buffer is IdxChunks[0] + IdxChunks[1] + ... + IdxBuffer and ImDrawCmd::IdxOffset counts from the start of IdxChunks[0].
+    int                     IdxChunksSize;      // Sum of IdxChunks[].Size
 
     // [Internal, used while building lists]
     unsigned int            _VtxCurrentIdx;     // [Internal] generally == VtxBuffer.Size unless we are past 64K vertices, in which case this gets reset to 0.
@@ -2514,6 +2634,8 @@ struct ImDrawList
     ImDrawCmdHeader         _CmdHeader;         // [Internal] template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
+    int                     _SplitDepth;        // [Internal] number of splitters currently split over this list. Only the outermost one may link channels into IdxChunks[].
+    ImVector<ImVector<ImDrawIdx> > _IdxChunksFree; // [Internal] storage of IdxChunks[] from last frame, handed back to channels by ImDrawListSplitter::Split()
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
     ImDrawList(const ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; }
@@ -2575,7 +2697,7 @@ struct ImDrawList
     // Advanced
     IMGUI_API void  AddCallback(ImDrawCallback callback, void* callback_data);  // Your rendering function must check for 'UserCallback' in ImDrawCmd and call the function instead of rendering triangles.
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
-    IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer. IdxChunks[] are flattened into IdxBuffer.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -2607,6 +2729,8 @@ struct ImDrawList
     // [Internal helpers]
     IMGUI_API void  _ResetForNewFrame();
     IMGUI_API void  _ClearFreeMemory();
+    IMGUI_API void  _FlattenIdxChunks();
+    IMGUI_API const ImDrawIdx* _GetFlatIdxBuffer(ImVector<ImDrawIdx>* temp_buffer) const;
     IMGUI_API void  _PopUnusedDrawCmd();
     IMGUI_API void  _TryMergeDrawCmds();
     IMGUI_API void  _OnChangedClipRect();
@@ -2624,7 +2748,7 @@ struct ImDrawData
 {
     bool            Valid;                  // Only valid after Render() is called and before the next NewFrame() is called.
     int             CmdListsCount;          // Number of ImDrawList* to render
-    int             TotalIdxCount;          // For convenience, sum of all ImDrawList's IdxBuffer.Size
+    int             TotalIdxCount;          // For convenience, sum of all ImDrawList's IdxChunksSize + IdxBuffer.Size
     int             TotalVtxCount;          // For convenience, sum of all ImDrawList's VtxBuffer.Size
     ImDrawList**    CmdLists;               // Array of ImDrawList* to render. The ImDrawList are owned by ImGuiContext and only pointed to from here.
     ImVec2          DisplayPos;             // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
@@ -2710,13 +2834,22 @@ struct ImFontAtlasCustomRect
     bool IsPacked() const           { return X != 0xFFFF; }
 };
 
+// Area of the font atlas texture modified after Build(), see ImFontAtlas::TexDirtyRects.
+struct ImFontAtlasDirtyRect
+{
+    unsigned short  X, Y;           // Position in the texture, in pixels
+    unsigned short  Width, Height;  // Size in pixels
+};
+
 // Flags for ImFontAtlas build
 enum ImFontAtlasFlags_
 {
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
-    ImFontAtlasFlags_NoBakedLines       = 1 << 2    // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 3,   // Only rasterize ASCII and fallback glyphs in Build(), and other glyphs of the requested ranges the first time they are rendered (stb_truetype builder only). The texture grows as needed. Requires a backend with ImGuiBackendFlags_RendererHasTexUpdates. Don't call ClearInputData()/ClearTexData() after building, or glyphs not rasterized yet will use the fallback glyph.
+    ImFontAtlasFlags_SignedDistanceField = 1 << 4   // Store glyphs as signed distance fields (stb_truetype builder only), so text stays sharp at any scale (e.g. io.FontGlobalScale, SetWindowFontScale()) without rebuilding the atlas. Glyphs are rasterized without oversampling or RasterizerMultiply. Implies ImFontAtlasFlags_NoBakedLines. Requires a backend with ImGuiBackendFlags_RendererHasSdfFonts. Custom rectangles are rendered through the same shader: only use fully opaque/transparent pixels in them.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2762,6 +2895,16 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't built texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Build cache: save the output of Build() (texture pixels, glyphs, lookup tables, custom rects positions) so next runs can restore it without parsing and rasterizing fonts.
+    // - Call LoadBuildCacheXXX() after adding fonts and custom rects, instead of Build(). It returns false if the data was saved with different fonts, settings or Dear ImGui version, or is damaged (checksum, sizes and indices are verified):
+    //   call Build() then SaveBuildCacheXXX() to refresh it. Custom rects pixels written after Build() are saved too.
+    // - LoadBuildCacheFromMemory() only reads the data during the call: you may pass data embedded in your executable or a read-only memory-mapped file.
+    // - Not supported with ImFontAtlasFlags_DynamicGlyphs (functions return false).
+    IMGUI_API bool              LoadBuildCacheFromMemory(const void* data, size_t data_size);
+    IMGUI_API bool              LoadBuildCacheFromDisk(const char* filename);
+    IMGUI_API bool              SaveBuildCacheToMemory(ImVector<unsigned char>* out_data);
+    IMGUI_API bool              SaveBuildCacheToDisk(const char* filename);
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -2805,6 +2948,8 @@ struct ImFontAtlas
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
+    int                         TexSdfSpread;       // Distance from glyph edges, in pixels at the font size, encoded around glyphs with ImFontAtlasFlags_SignedDistanceField. Defaults to 4. Larger values keep edges smooth when text is scaled further down, but use more texture space.
+    int                         BuildThreadsCount;  // Number of threads used by Build() to collect glyphs and rasterize them, the calling thread included. Defaults to 0 (one per hardware thread). Requires IMGUI_ENABLE_THREADED_FONT_BUILD, ignored otherwise.
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
 
     // [Internal]
@@ -2821,10 +2966,12 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVector<ImFontAtlasDirtyRect> TexDirtyRects;   // Areas of the texture modified since the backend last uploaded it (ImFontAtlasFlags_DynamicGlyphs). The backend uploads then clears them, or re-creates its texture when TexWidth/TexHeight changed.
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
     unsigned int                FontBuilderFlags;   // Shared flags (for all fonts) for custom font builder. THIS IS BUILD IMPLEMENTATION DEPENDENT. Per-font override is also available in ImFontConfig.
+    void*                       DynamicGlyphsData;  // Builder state kept after Build() to rasterize glyphs on demand (ImFontAtlasFlags_DynamicGlyphs)
 
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
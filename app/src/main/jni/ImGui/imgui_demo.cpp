@@ -489,6 +489,9 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseCursors",      &backend_flags, ImGuiBackendFlags_HasMouseCursors);
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &backend_flags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &backend_flags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasTexUpdates", &backend_flags, ImGuiBackendFlags_RendererHasTexUpdates);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasSdfFonts", &backend_flags, ImGuiBackendFlags_RendererHasSdfFonts);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasIdxChunks", &backend_flags, ImGuiBackendFlags_RendererHasIdxChunks);
             ImGui::TreePop();
             ImGui::Separator();
         }
@@ -3616,6 +3619,23 @@ struct MyItem
         // Your own compare function may want to avoid fallback on implicit sort specs e.g. a Name compare if it wasn't already part of the sort specs.
         return (a->ID - b->ID);
     }
+
+    // Compare function to be used by ImGuiTableSortIndex, with a ImVector<MyItem>* as user data.
+    // It compares two rows on a single column in ascending order: the sort index takes care of the sort direction and of multiple sort specs.
+    static int CompareRows(int row_a, int row_b, const ImGuiTableColumnSortSpecs* sort_spec, void* user_data)
+    {
+        const ImVector<MyItem>& items = *(const ImVector<MyItem>*)user_data;
+        const MyItem* a = &items[row_a];
+        const MyItem* b = &items[row_b];
+        switch (sort_spec->ColumnUserID)
+        {
+        case MyItemColumnID_ID:             return (a->ID - b->ID);
+        case MyItemColumnID_Name:           return strcmp(a->Name, b->Name);
+        case MyItemColumnID_Quantity:       return (a->Quantity - b->Quantity);
+        case MyItemColumnID_Description:    return strcmp(a->Name, b->Name);
+        default: IM_ASSERT(0); return 0;
+        }
+    }
 };
 const ImGuiTableSortSpecs* MyItem::s_current_sort_specs = NULL;
 }
@@ -5077,24 +5097,22 @@ static void ShowDemoWindowTables()
             ImGui::TableSetupScrollFreeze(0, 1); // Make row always visible
             ImGui::TableHeadersRow();
 
-            // Sort our data if sort specs have been changed!
-            if (ImGuiTableSortSpecs* sorts_specs = ImGui::TableGetSortSpecs())
-                if (sorts_specs->SpecsDirty)
-                {
-                    MyItem::s_current_sort_specs = sorts_specs; // Store in variable accessible by the sort function.
-                    if (items.Size > 1)
-                        qsort(&items[0], (size_t)items.Size, sizeof(items[0]), MyItem::CompareWithSortSpecs);
-                    MyItem::s_current_sort_specs = NULL;
-                    sorts_specs->SpecsDirty = false;
-                }
+            // Keep a sorted index of our rows, updated when sort specs have been changed!
+            // Instead of sorting the data itself, this gives the order in which to display rows. It can also cheaply move a few modified rows.
+            // (See the "Advanced" section below for sorting the data itself with qsort())
+            static ImGuiTableSortIndex sort_index;
+            sort_index.CompareFunc = MyItem::CompareRows;
+            sort_index.UserData = &items;
+            sort_index.Update(ImGui::TableGetSortSpecs(), items.Size);
 
             // Demonstrate using clipper for large vertical lists
             ImGuiListClipper clipper;
             clipper.Begin(items.Size);
             while (clipper.Step())
-                for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                for (int display_n = clipper.DisplayStart; display_n < clipper.DisplayEnd; display_n++)
                 {
                     // Display a data item
+                    const int row_n = sort_index.Rows[display_n];
                     MyItem* item = &items[row_n];
                     ImGui::PushID(item->ID);
                     ImGui::TableNextRow();
@@ -5103,7 +5121,11 @@ static void ShowDemoWindowTables()
                     ImGui::TableNextColumn();
                     ImGui::TextUnformatted(item->Name);
                     ImGui::TableNextColumn();
-                    ImGui::SmallButton("None");
+                    if (ImGui::SmallButton("+1"))
+                    {
+                        item->Quantity++;
+                        sort_index.MarkRowDirty(row_n); // Move the row to its new position on the next Update()
+                    }
                     ImGui::TableNextColumn();
                     ImGui::Text("%d", item->Quantity);
                     ImGui::PopID();
@@ -5962,6 +5984,15 @@ void ImGui::ShowAboutWindow(bool* p_open)
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
         ImGui::Text("define: IMGUI_USE_BGRA_PACKED_COLOR");
 #endif
+#ifdef IMGUI_USE_HW_CRC32
+        ImGui::Text("define: IMGUI_USE_HW_CRC32");
+#endif
+#ifdef IMGUI_USE_FAST_HASH
+        ImGui::Text("define: IMGUI_USE_FAST_HASH");
+#endif
+#ifdef IMGUI_USE_HASHED_STORAGE
+        ImGui::Text("define: IMGUI_USE_HASHED_STORAGE");
+#endif
 #ifdef _WIN32
         ImGui::Text("define: _WIN32");
 #endif
@@ -6013,6 +6044,9 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates)  ImGui::Text(" RendererHasTexUpdates");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasSdfFonts)    ImGui::Text(" RendererHasSdfFonts");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasIdxChunks)   ImGui::Text(" RendererHasIdxChunks");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
         ImGui::Text("io.DisplaySize: %.2f,%.2f", io.DisplaySize.x, io.DisplaySize.y);
@@ -6281,6 +6315,10 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
             HelpMarker("Faster lines using texture data. Require backend to render with bilinear filtering (not point/nearest filtering).");
 
             ImGui::Checkbox("Anti-aliased fill", &style.AntiAliasedFill);
+
+            ImGui::Checkbox("Joined lines", &style.JoinedLines);
+            ImGui::SameLine();
+            HelpMarker("Lines drawn without anti-aliasing share vertices between consecutive segments, with miter joins at corners.");
             ImGui::PushItemWidth(ImGui::GetFontSize() * 8);
             ImGui::DragFloat("Curve Tessellation Tolerance", &style.CurveTessellationTol, 0.02f, 0.10f, 10.0f, "%.2f");
             if (style.CurveTessellationTol < 0.10f) style.CurveTessellationTol = 0.10f;
@@ -7146,7 +7184,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to TextWrapped(), clipped, varying heights\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -7182,6 +7221,25 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Lines of varying heights, coarsely clipped using ImGuiListClipper with a height index.
+            // The clipper measures each displayed line and stores its height in the index, which persists across frames.
+            static ImGuiListClipperHeightIndex heights;
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            ImGuiListClipper clipper;
+            clipper.Begin(lines, &heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                {
+                    if (i % 5 == 0)
+                        ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.", i);
+                    else
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
+                }
+            ImGui::PopStyleVar();
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
@@ -39,6 +39,9 @@ Index of this file:
 #endif
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#ifdef IMGUI_ENABLE_THREADED_FONT_BUILD
+#include <thread>       // std::thread
+#endif
 #if !defined(alloca)
 #if defined(__GLIBC__) || defined(__sun) || defined(__APPLE__) || defined(__NEWLIB__)
 #include <alloca.h>     // alloca (glibc uses <alloca.h>. Note that Cygwin may have _WIN32 defined, so the order matters here)
@@ -144,8 +147,15 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
+#ifdef IMGUI_ENABLE_THREADED_FONT_BUILD
+// Font atlas build threads pass a ImFontBuildThreadAllocator* as stbtt_fontinfo::userdata (see ImFontAtlasBuildParallelFor())
+struct ImFontBuildThreadAllocator { ImGuiMemAllocFunc AllocFunc; ImGuiMemFreeFunc FreeFunc; void* UserData; };
+#define STBTT_malloc(x,u)   ((u) ? ((ImFontBuildThreadAllocator*)(u))->AllocFunc(x, ((ImFontBuildThreadAllocator*)(u))->UserData) : IM_ALLOC(x))
+#define STBTT_free(x,u)     ((u) ? ((ImFontBuildThreadAllocator*)(u))->FreeFunc(x, ((ImFontBuildThreadAllocator*)(u))->UserData) : IM_FREE(x))
+#else
 #define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
 #define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+#endif
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -441,6 +451,13 @@ void ImDrawList::_ResetForNewFrame()
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    for (int n = 0; n < IdxChunks.Size; n++)
+    {
+        IdxChunks[n].resize(0);
+        _IdxChunksFree.push_back(IdxChunks[n]);
+    }
+    IdxChunks.resize(0);
+    IdxChunksSize = 0;
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
@@ -452,6 +469,7 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = 1.0f;
+    _SplitDepth = 0;
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -459,6 +477,13 @@ void ImDrawList::_ClearFreeMemory()
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    for (int n = 0; n < IdxChunks.Size; n++)
+        IdxChunks[n].clear();
+    for (int n = 0; n < _IdxChunksFree.Size; n++)
+        _IdxChunksFree[n].clear();
+    IdxChunks.clear();
+    IdxChunksSize = 0;
+    _IdxChunksFree.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
@@ -467,13 +492,58 @@ void ImDrawList::_ClearFreeMemory()
     _TextureIdStack.clear();
     _Path.clear();
     _Splitter.ClearFreeMemory();
+    _SplitDepth = 0;
+}
+
+// Move all index data into IdxBuffer[], for code which needs it contiguous (ImDrawListFlags_AllowIdxChunks).
+// Storage of the first chunk is grown to hold everything, the other buffers are kept for reuse.
+void ImDrawList::_FlattenIdxChunks()
+{
+    if (IdxChunks.Size == 0)
+        return;
+    ImVector<ImDrawIdx>& dst = IdxChunks[0];
+    dst.reserve(IdxChunksSize + IdxBuffer.Size);
+    for (int n = 1; n <= IdxChunks.Size; n++)
+    {
+        ImVector<ImDrawIdx>& src = (n < IdxChunks.Size) ? IdxChunks[n] : IdxBuffer;
+        if (src.Size > 0)
+            memcpy(dst.Data + dst.Size, src.Data, (size_t)src.Size * sizeof(ImDrawIdx));
+        dst.Size += src.Size;
+        src.resize(0);
+        if (src.Capacity > 0)
+            _IdxChunksFree.push_back(src);
+    }
+    memcpy(&IdxBuffer, &dst, sizeof(IdxBuffer));
+    IdxChunks.resize(0);
+    IdxChunksSize = 0;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+}
+
+// Return the whole index buffer as a single array: IdxBuffer.Data, or 'temp_buffer' filled with IdxChunks[] + IdxBuffer[].
+const ImDrawIdx* ImDrawList::_GetFlatIdxBuffer(ImVector<ImDrawIdx>* temp_buffer) const
+{
+    if (IdxChunks.Size == 0)
+        return IdxBuffer.Data;
+    temp_buffer->resize(IdxChunksSize + IdxBuffer.Size);
+    ImDrawIdx* idx_write = temp_buffer->Data;
+    for (int n = 0; n <= IdxChunks.Size; n++)
+    {
+        const ImVector<ImDrawIdx>& src = (n < IdxChunks.Size) ? IdxChunks[n] : IdxBuffer;
+        if (src.Size > 0)
+            memcpy(idx_write, src.Data, (size_t)src.Size * sizeof(ImDrawIdx));
+        idx_write += src.Size;
+    }
+    return temp_buffer->Data;
 }
 
 ImDrawList* ImDrawList::CloneOutput() const
 {
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
-    dst->IdxBuffer = IdxBuffer;
+    if (IdxChunks.Size > 0)
+        _GetFlatIdxBuffer(&dst->IdxBuffer);
+    else
+        dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
     dst->Flags = Flags;
     return dst;
@@ -485,7 +555,7 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.ClipRect = _CmdHeader.ClipRect;    // Same as calling ImDrawCmd_HeaderCopy()
     draw_cmd.TextureId = _CmdHeader.TextureId;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
-    draw_cmd.IdxOffset = IdxBuffer.Size;
+    draw_cmd.IdxOffset = IdxChunksSize + IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
     CmdBuffer.push_back(draw_cmd);
@@ -747,6 +817,205 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = ImRsqrt(d2); VX *= inv_len; VY *= inv_len; } } (void)0
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
+#define IM_JOINEDLINES_MITER_LIMIT2         4.0f   // Max squared miter length (in half thickness units) of joined lines before using a bevel join: corners sharper than 60 degrees are beveled.
+
+// SIMD helpers for AddPolyline(), processing 4 points at a time.
+// They perform the same operations in the same order as the scalar code and its macros above (including the choice of ImRsqrt() implementation),
+// so the vertex output is identical whether or not SIMD is enabled.
+#if defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)
+#define IM_POLYLINE_SIMD
+#if defined(IMGUI_ENABLE_SSE)
+typedef __m128 ImPolylineF4;
+static inline ImPolylineF4  ImPolylineSet1(float v)                                         { return _mm_set1_ps(v); }
+static inline ImPolylineF4  ImPolylineAdd(ImPolylineF4 a, ImPolylineF4 b)                   { return _mm_add_ps(a, b); }
+static inline ImPolylineF4  ImPolylineSub(ImPolylineF4 a, ImPolylineF4 b)                   { return _mm_sub_ps(a, b); }
+static inline ImPolylineF4  ImPolylineMul(ImPolylineF4 a, ImPolylineF4 b)                   { return _mm_mul_ps(a, b); }
+static inline ImPolylineF4  ImPolylineDiv(ImPolylineF4 a, ImPolylineF4 b)                   { return _mm_div_ps(a, b); }
+static inline ImPolylineF4  ImPolylineMin(ImPolylineF4 a, ImPolylineF4 b)                   { return _mm_min_ps(a, b); }
+static inline ImPolylineF4  ImPolylineNeg(ImPolylineF4 a)                                   { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+static inline ImPolylineF4  ImPolylineRsqrt(ImPolylineF4 a)                                 { return _mm_rsqrt_ps(a); }
+static inline ImPolylineF4  ImPolylineSelectGt(ImPolylineF4 a, ImPolylineF4 b, ImPolylineF4 t, ImPolylineF4 f) { ImPolylineF4 m = _mm_cmpgt_ps(a, b); return _mm_or_ps(_mm_and_ps(m, t), _mm_andnot_ps(m, f)); } // a > b ? t : f
+static inline void          ImPolylineLoad4(const ImVec2* src, ImPolylineF4* x, ImPolylineF4* y)
+{
+    ImPolylineF4 a = _mm_loadu_ps(&src[0].x), b = _mm_loadu_ps(&src[2].x);
+    *x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    *y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+static inline void          ImPolylineStore4(ImVec2* dst, ImPolylineF4 x, ImPolylineF4 y)
+{
+    _mm_storeu_ps(&dst[0].x, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(&dst[2].x, _mm_unpackhi_ps(x, y));
+}
+static inline void          ImPolylineStoreVtxPos4(ImDrawVert* dst, int stride, ImPolylineF4 x, ImPolylineF4 y)
+{
+    ImPolylineF4 lo = _mm_unpacklo_ps(x, y), hi = _mm_unpackhi_ps(x, y);
+    _mm_storel_pi((__m64*)&dst[stride * 0].pos, lo);
+    _mm_storeh_pi((__m64*)&dst[stride * 1].pos, lo);
+    _mm_storel_pi((__m64*)&dst[stride * 2].pos, hi);
+    _mm_storeh_pi((__m64*)&dst[stride * 3].pos, hi);
+}
+#else
+typedef float32x4_t ImPolylineF4;
+static inline ImPolylineF4  ImPolylineSet1(float v)                                         { return vdupq_n_f32(v); }
+static inline ImPolylineF4  ImPolylineAdd(ImPolylineF4 a, ImPolylineF4 b)                   { return vaddq_f32(a, b); }
+static inline ImPolylineF4  ImPolylineSub(ImPolylineF4 a, ImPolylineF4 b)                   { return vsubq_f32(a, b); }
+static inline ImPolylineF4  ImPolylineMul(ImPolylineF4 a, ImPolylineF4 b)                   { return vmulq_f32(a, b); }
+static inline ImPolylineF4  ImPolylineDiv(ImPolylineF4 a, ImPolylineF4 b)                   { return vdivq_f32(a, b); }
+static inline ImPolylineF4  ImPolylineMin(ImPolylineF4 a, ImPolylineF4 b)                   { return vminq_f32(a, b); }
+static inline ImPolylineF4  ImPolylineNeg(ImPolylineF4 a)                                   { return vnegq_f32(a); }
+static inline ImPolylineF4  ImPolylineRsqrt(ImPolylineF4 a)                                 { return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(a)); } // Same as scalar ImRsqrt()
+static inline ImPolylineF4  ImPolylineSelectGt(ImPolylineF4 a, ImPolylineF4 b, ImPolylineF4 t, ImPolylineF4 f) { return vbslq_f32(vcgtq_f32(a, b), t, f); } // a > b ? t : f
+static inline void          ImPolylineLoad4(const ImVec2* src, ImPolylineF4* x, ImPolylineF4* y)
+{
+    float32x4x2_t v = vld2q_f32(&src[0].x);
+    *x = v.val[0];
+    *y = v.val[1];
+}
+static inline void          ImPolylineStore4(ImVec2* dst, ImPolylineF4 x, ImPolylineF4 y)
+{
+    float32x4x2_t v = { { x, y } };
+    vst2q_f32(&dst[0].x, v);
+}
+static inline void          ImPolylineStoreVtxPos4(ImDrawVert* dst, int stride, ImPolylineF4 x, ImPolylineF4 y)
+{
+    float32x4x2_t v = vzipq_f32(x, y);
+    vst1_f32(&dst[stride * 0].pos.x, vget_low_f32(v.val[0]));
+    vst1_f32(&dst[stride * 1].pos.x, vget_high_f32(v.val[0]));
+    vst1_f32(&dst[stride * 2].pos.x, vget_low_f32(v.val[1]));
+    vst1_f32(&dst[stride * 3].pos.x, vget_high_f32(v.val[1]));
+}
+#endif
+
+// Same as IM_NORMALIZE2F_OVER_ZERO() and IM_FIXNORMAL2F()
+static inline void ImPolylineNormalizeOverZero(ImPolylineF4* vx, ImPolylineF4* vy)
+{
+    ImPolylineF4 d2 = ImPolylineAdd(ImPolylineMul(*vx, *vx), ImPolylineMul(*vy, *vy));
+    ImPolylineF4 inv_len = ImPolylineSelectGt(d2, ImPolylineSet1(0.0f), ImPolylineRsqrt(d2), ImPolylineSet1(1.0f));
+    *vx = ImPolylineMul(*vx, inv_len);
+    *vy = ImPolylineMul(*vy, inv_len);
+}
+static inline void ImPolylineFixNormal(ImPolylineF4* vx, ImPolylineF4* vy)
+{
+    ImPolylineF4 d2 = ImPolylineAdd(ImPolylineMul(*vx, *vx), ImPolylineMul(*vy, *vy));
+    ImPolylineF4 inv_len2 = ImPolylineMin(ImPolylineDiv(ImPolylineSet1(1.0f), d2), ImPolylineSet1(IM_FIXNORMAL2F_MAX_INVLEN2));
+    inv_len2 = ImPolylineSelectGt(d2, ImPolylineSet1(0.000001f), inv_len2, ImPolylineSet1(1.0f));
+    *vx = ImPolylineMul(*vx, inv_len2);
+    *vy = ImPolylineMul(*vy, inv_len2);
+}
+#endif // #if defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)
+
+// Add the vertices of each point of an anti-aliased polyline (see AddPolyline()), written directly into the vertex buffer.
+// - Points are offset along the average of the normals of the two segments joining at that point: point n uses the normals of segments n-1 and n,
+//   with the first point in a closed line using the final segment. If line is not closed, the first point only has the normal of the first segment
+//   (the last point has a copy of the normal of the last segment, so it goes through the same averaging).
+// - Each point emits VTX_COUNT vertices copied from 'vtx_desc', with their position set to the point offset by 'offsets[n]' times the normal.
+template<int VTX_COUNT>
+static inline void ImPolylineWriteVerticesT(ImDrawVert* vtx, const ImDrawVert* vtx_desc, const float* offsets, const ImVec2& p, float dm_x, float dm_y)
+{
+    for (int n = 0; n < VTX_COUNT; n++)
+    {
+        if (offsets[n] == 0.0f)
+            vtx[n].pos = p;
+        else
+            { vtx[n].pos.x = p.x + dm_x * offsets[n]; vtx[n].pos.y = p.y + dm_y * offsets[n]; }
+        vtx[n].uv = vtx_desc[n].uv;
+        vtx[n].col = vtx_desc[n].col;
+    }
+}
+
+template<int VTX_COUNT>
+static void ImPolylineAddVerticesT(ImDrawVert* vtx_write, const ImDrawVert* vtx_desc, const float* offsets, const ImVec2* points, const ImVec2* normals, const int points_count, bool closed)
+{
+    {
+        float dm_x = normals[0].x;
+        float dm_y = normals[0].y;
+        if (closed)
+        {
+            dm_x = (normals[points_count - 1].x + normals[0].x) * 0.5f;
+            dm_y = (normals[points_count - 1].y + normals[0].y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+        }
+        ImPolylineWriteVerticesT<VTX_COUNT>(vtx_write, vtx_desc, offsets, points[0], dm_x, dm_y);
+    }
+
+    int i = 1;
+#ifdef IM_POLYLINE_SIMD
+    for (; i + 4 <= points_count; i += 4) // Points i..i+3
+    {
+        ImPolylineF4 n1_x, n1_y, n2_x, n2_y, p_x, p_y;
+        ImPolylineLoad4(&normals[i - 1], &n1_x, &n1_y);
+        ImPolylineLoad4(&normals[i], &n2_x, &n2_y);
+        ImPolylineLoad4(&points[i], &p_x, &p_y);
+
+        // Average normals
+        const ImPolylineF4 half = ImPolylineSet1(0.5f);
+        ImPolylineF4 dm_x = ImPolylineMul(ImPolylineAdd(n1_x, n2_x), half);
+        ImPolylineF4 dm_y = ImPolylineMul(ImPolylineAdd(n1_y, n2_y), half);
+        ImPolylineFixNormal(&dm_x, &dm_y);
+
+        ImDrawVert* vtx = vtx_write + i * VTX_COUNT;
+        for (int n = 0; n < VTX_COUNT; n++)
+        {
+            if (offsets[n] == 0.0f)
+                ImPolylineStoreVtxPos4(vtx + n, VTX_COUNT, p_x, p_y);
+            else
+                ImPolylineStoreVtxPos4(vtx + n, VTX_COUNT, ImPolylineAdd(p_x, ImPolylineMul(dm_x, ImPolylineSet1(offsets[n]))), ImPolylineAdd(p_y, ImPolylineMul(dm_y, ImPolylineSet1(offsets[n]))));
+        }
+        for (int n = 0; n < VTX_COUNT * 4; n++)
+        {
+            vtx[n].uv = vtx_desc[n % VTX_COUNT].uv;
+            vtx[n].col = vtx_desc[n % VTX_COUNT].col;
+        }
+    }
+#endif
+    for (; i < points_count; i++)
+    {
+        float dm_x = (normals[i - 1].x + normals[i].x) * 0.5f;
+        float dm_y = (normals[i - 1].y + normals[i].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        ImPolylineWriteVerticesT<VTX_COUNT>(vtx_write + i * VTX_COUNT, vtx_desc, offsets, points[i], dm_x, dm_y);
+    }
+}
+
+// Add the indices forming the triangles of each segment of an anti-aliased polyline (see AddPolyline()), for VTX_COUNT vertices per point.
+// This takes points n and n+1, with the last segment of a closed line wrapping to the first point.
+template<int VTX_COUNT>
+static void ImPolylineAddIndicesT(ImDrawIdx* idx_write, const unsigned int vtx_start, const int points_count, const int segments_count)
+{
+    unsigned int idx1 = vtx_start; // Vertex index for start of line segment
+    for (int i1 = 0; i1 < segments_count; i1++) // i1 is the first point of the line segment
+    {
+        const unsigned int idx2 = (i1 + 1) == points_count ? vtx_start : (idx1 + VTX_COUNT); // Vertex index for end of segment
+        if (VTX_COUNT == 2)
+        {
+            // Add indices for two triangles
+            idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 1); // Right tri
+            idx_write[3] = (ImDrawIdx)(idx2 + 1); idx_write[4] = (ImDrawIdx)(idx1 + 1); idx_write[5] = (ImDrawIdx)(idx2 + 0); // Left tri
+            idx_write += 6;
+        }
+        else if (VTX_COUNT == 3)
+        {
+            // Add indexes for four triangles
+            idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
+            idx_write[3] = (ImDrawIdx)(idx1 + 2); idx_write[4] = (ImDrawIdx)(idx2 + 2); idx_write[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
+            idx_write[6] = (ImDrawIdx)(idx2 + 1); idx_write[7] = (ImDrawIdx)(idx1 + 1); idx_write[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
+            idx_write[9] = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
+            idx_write += 12;
+        }
+        else
+        {
+            // Add indexes for six triangles
+            idx_write[0]  = (ImDrawIdx)(idx2 + 1); idx_write[1]  = (ImDrawIdx)(idx1 + 1); idx_write[2]  = (ImDrawIdx)(idx1 + 2);
+            idx_write[3]  = (ImDrawIdx)(idx1 + 2); idx_write[4]  = (ImDrawIdx)(idx2 + 2); idx_write[5]  = (ImDrawIdx)(idx2 + 1);
+            idx_write[6]  = (ImDrawIdx)(idx2 + 1); idx_write[7]  = (ImDrawIdx)(idx1 + 1); idx_write[8]  = (ImDrawIdx)(idx1 + 0);
+            idx_write[9]  = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+            idx_write[12] = (ImDrawIdx)(idx2 + 2); idx_write[13] = (ImDrawIdx)(idx1 + 2); idx_write[14] = (ImDrawIdx)(idx1 + 3);
+            idx_write[15] = (ImDrawIdx)(idx1 + 3); idx_write[16] = (ImDrawIdx)(idx2 + 3); idx_write[17] = (ImDrawIdx)(idx2 + 2);
+            idx_write += 18;
+        }
+        idx1 = idx2;
+    }
+}
 
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
@@ -783,13 +1052,22 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
         PrimReserve(idx_count, vtx_count);
 
-        // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        ImVec2* temp_normals = (ImVec2*)alloca(points_count * ((use_texture || !thick_line) ? 3 : 5) * sizeof(ImVec2)); //-V630
-        ImVec2* temp_points = temp_normals + points_count;
-
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
+        ImVec2* temp_normals = (ImVec2*)alloca(points_count * sizeof(ImVec2)); //-V630
+        int i1 = 0;
+#ifdef IM_POLYLINE_SIMD
+        for (; i1 + 4 < points_count; i1 += 4) // Segments i1..i1+3
+        {
+            ImPolylineF4 x1, y1, x2, y2;
+            ImPolylineLoad4(&points[i1], &x1, &y1);
+            ImPolylineLoad4(&points[i1 + 1], &x2, &y2);
+            ImPolylineF4 dx = ImPolylineSub(x2, x1);
+            ImPolylineF4 dy = ImPolylineSub(y2, y1);
+            ImPolylineNormalizeOverZero(&dx, &dy);
+            ImPolylineStore4(&temp_normals[i1], dy, ImPolylineNeg(dx));
+        }
+#endif
+        for (; i1 < count; i1++)
         {
             const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
             float dx = points[i2].x - points[i1].x;
@@ -801,176 +1079,166 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
 
-        // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
-        if (use_texture || !thick_line)
+        // Add vertices: describe the 2, 3 or 4 vertices emitted for each point, with their offset along the point normal.
+        // The width of the geometry we need to draw in PATH 1 and PATH 2 is essentially <thickness> pixels for the line itself, plus "one pixel" for AA.
+        // - In the texture-based path, we don't use AA_SIZE here because the +1 is tied to the generated texture
+        //   (see ImFontAtlasBuildRenderLinesTexData() function), and so alternate values won't work without changes to that code.
+        // - In the non texture-based paths, we would allow AA_SIZE to potentially be != 1.0f with a patch (e.g. fringe_scale patch to
+        //   allow scaling geometry while preserving one-screen-pixel AA fringe).
+        ImDrawVert vtx_desc[4];
+        float vtx_offsets[4];
+        for (int n = 0; n < 4; n++)
         {
-            // [PATH 1] Texture-based lines (thick or non-thick)
-            // [PATH 2] Non texture-based lines (non-thick)
-
-            // The width of the geometry we need to draw - this is essentially <thickness> pixels for the line itself, plus "one pixel" for AA.
-            // - In the texture-based path, we don't use AA_SIZE here because the +1 is tied to the generated texture
-            //   (see ImFontAtlasBuildRenderLinesTexData() function), and so alternate values won't work without changes to that code.
-            // - In the non texture-based paths, we would allow AA_SIZE to potentially be != 1.0f with a patch (e.g. fringe_scale patch to
-            //   allow scaling geometry while preserving one-screen-pixel AA fringe).
-            const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
-
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
-            {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
-                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
-                if (use_texture)
-                {
-                    // Add indices for two triangles
-                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 1); // Right tri
-                    _IdxWritePtr[3] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[4] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Left tri
-                    _IdxWritePtr += 6;
-                }
-                else
-                {
-                    // Add indexes for four triangles
-                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
-                    _IdxWritePtr[3] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
-                    _IdxWritePtr[6] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
-                    _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
-                    _IdxWritePtr += 12;
-                }
-
-                idx1 = idx2;
-            }
-
-            // Add vertexes for each point on the line
-            if (use_texture)
-            {
-                // If we're using textures we only need to emit the left/right edge vertices
-                ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
-                /*if (fractional_thickness != 0.0f) // Currently always zero when use_texture==false!
-                {
-                    const ImVec4 tex_uvs_1 = _Data->TexUvLines[integer_thickness + 1];
-                    tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
-                    tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
-                    tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
-                    tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
-                }*/
-                ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
-                ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
-                    _VtxWritePtr += 2;
-                }
-            }
-            else
+            vtx_desc[n].pos = ImVec2(0.0f, 0.0f);
+            vtx_desc[n].uv = opaque_uv;
+            vtx_desc[n].col = col;
+        }
+        if (use_texture)
+        {
+            // [PATH 1] Texture-based lines (thick or non-thick): we only need the left/right edge vertices
+            ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
+            /*if (fractional_thickness != 0.0f) // Currently always zero when use_texture==false!
             {
-                // If we're not using a texture, we need the center vertex as well
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
-                    _VtxWritePtr += 3;
-                }
-            }
+                const ImVec4 tex_uvs_1 = _Data->TexUvLines[integer_thickness + 1];
+                tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
+                tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
+                tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
+                tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
+            }*/
+            const float half_draw_size = (thickness * 0.5f) + 1;
+            vtx_offsets[0] = +half_draw_size; vtx_desc[0].uv = ImVec2(tex_uvs.x, tex_uvs.y); // Left-side outer edge
+            vtx_offsets[1] = -half_draw_size; vtx_desc[1].uv = ImVec2(tex_uvs.z, tex_uvs.w); // Right-side outer edge
+            ImPolylineAddVerticesT<2>(_VtxWritePtr, vtx_desc, vtx_offsets, points, temp_normals, points_count, closed);
+        }
+        else if (!thick_line)
+        {
+            // [PATH 2] Non texture-based lines (non-thick): we need the center vertex as well
+            const float half_draw_size = AA_SIZE;
+            vtx_offsets[0] = 0.0f;                                          // Center of line
+            vtx_offsets[1] = +half_draw_size; vtx_desc[1].col = col_trans;  // Left-side outer edge
+            vtx_offsets[2] = -half_draw_size; vtx_desc[2].col = col_trans;  // Right-side outer edge
+            ImPolylineAddVerticesT<3>(_VtxWritePtr, vtx_desc, vtx_offsets, points, temp_normals, points_count, closed);
         }
         else
         {
-            // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
+            // [PATH 3] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+            vtx_offsets[0] = +(half_inner_thickness + AA_SIZE); vtx_desc[0].col = col_trans;
+            vtx_offsets[1] = +half_inner_thickness;
+            vtx_offsets[2] = -half_inner_thickness;
+            vtx_offsets[3] = -(half_inner_thickness + AA_SIZE); vtx_desc[3].col = col_trans;
+            ImPolylineAddVerticesT<4>(_VtxWritePtr, vtx_desc, vtx_offsets, points, temp_normals, points_count, closed);
+        }
+        _VtxWritePtr += vtx_count;
+
+        // Add indices
+        if (use_texture)
+            ImPolylineAddIndicesT<2>(_IdxWritePtr, _VtxCurrentIdx, points_count, count);
+        else if (!thick_line)
+            ImPolylineAddIndicesT<3>(_IdxWritePtr, _VtxCurrentIdx, points_count, count);
+        else
+            ImPolylineAddIndicesT<4>(_IdxWritePtr, _VtxCurrentIdx, points_count, count);
+        _IdxWritePtr += idx_count;
+        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+    else if (Flags & ImDrawListFlags_JoinedLines)
+    {
+        // [PATH 5] Non texture-based, Non anti-aliased joined lines
+        // Consecutive segments share their edge vertices: each point emits 2 vertices offset along the miter of its two segments,
+        // or 3 vertices for a bevel join (outer edge of each segment + inner miter) when requested or when the miter would be too long.
+        const float half_thickness = thickness * 0.5f;
+        const bool bevel_all = (Flags & ImDrawListFlags_JoinedLinesBevel) != 0;
+        const int idx_count_max = count * 6 + points_count * 3;
+        const int vtx_count_max = points_count * 3;
+        PrimReserve(idx_count_max, vtx_count_max);
+
+        // Calculate normals for each line segment
+        ImVec2* temp_normals = (ImVec2*)alloca(count * sizeof(ImVec2)); //-V630
+        for (int i1 = 0; i1 < count; i1++)
+        {
+            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+            float dx = points[i2].x - points[i1].x;
+            float dy = points[i2].y - points[i1].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            temp_normals[i1].x = dy;
+            temp_normals[i1].y = -dx;
+        }
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
+        // Add vertices for each point, and the two triangles of the segment ending at that point.
+        // Each point has an incoming and outgoing pair of left/right vertex indices, which are the same for a miter join.
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int vtx_idx = _VtxCurrentIdx;
+        unsigned int first_in_l = 0, first_in_r = 0, prev_out_l = 0, prev_out_r = 0;
+        for (int i = 0; i < points_count; i++)
+        {
+            // Normals of the two segments joining at this point (the same one twice at the ends of a line which is not closed)
+            const ImVec2& p = points[i];
+            const ImVec2& n_in = (i > 0) ? temp_normals[i - 1] : closed ? temp_normals[count - 1] : temp_normals[0];
+            const ImVec2& n_out = (i < count) ? temp_normals[i] : temp_normals[count - 1];
+            float dm_x = (n_in.x + n_out.x) * 0.5f;
+            float dm_y = (n_in.y + n_out.y) * 0.5f;
+            const float d2 = dm_x * dm_x + dm_y * dm_y;
+            const float inv_len2 = (d2 > 0.000001f) ? 1.0f / d2 : IM_JOINEDLINES_MITER_LIMIT2 + 1.0f;
+            const bool bevel = (inv_len2 > IM_JOINEDLINES_MITER_LIMIT2) || (bevel_all && (n_in.x != n_out.x || n_in.y != n_out.y));
+            const float miter_scale = ImMin(inv_len2, IM_FIXNORMAL2F_MAX_INVLEN2) * half_thickness;
+            dm_x *= miter_scale; // dm_x, dm_y are offset to the left edge of the line at a miter join, or to the inner edge at a bevel join
+            dm_y *= miter_scale;
+
+            unsigned int in_l, in_r, out_l, out_r;
+            if (!bevel)
             {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
+                vtx_write[0].pos.x = p.x + dm_x; vtx_write[0].pos.y = p.y + dm_y; vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;
+                vtx_write[1].pos.x = p.x - dm_x; vtx_write[1].pos.y = p.y - dm_y; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+                vtx_write += 2;
+                in_l = out_l = vtx_idx;
+                in_r = out_r = vtx_idx + 1;
+                vtx_idx += 2;
             }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            else
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
-                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
-                _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
-                _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
-                _IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
-                _IdxWritePtr[9]  = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1);
-                _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
-                _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
-                _IdxWritePtr += 18;
-
-                idx1 = idx2;
+                // Outer side of the corner gets the edges of both segments, inner side gets the (clamped) miter
+                const float side = (n_in.x * n_out.y - n_in.y * n_out.x) >= 0.0f ? +1.0f : -1.0f; // +1.0f when left edge is outside
+                vtx_write[0].pos.x = p.x + n_in.x * half_thickness * side;  vtx_write[0].pos.y = p.y + n_in.y * half_thickness * side;  vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;
+                vtx_write[1].pos.x = p.x + n_out.x * half_thickness * side; vtx_write[1].pos.y = p.y + n_out.y * half_thickness * side; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+                vtx_write[2].pos.x = p.x - dm_x * side;                     vtx_write[2].pos.y = p.y - dm_y * side;                     vtx_write[2].uv = opaque_uv; vtx_write[2].col = col;
+                vtx_write += 3;
+                if (side > 0.0f)
+                    { in_l = vtx_idx; out_l = vtx_idx + 1; in_r = out_r = vtx_idx + 2; }
+                else
+                    { in_r = vtx_idx; out_r = vtx_idx + 1; in_l = out_l = vtx_idx + 2; }
+                idx_write[0] = (ImDrawIdx)(vtx_idx); idx_write[1] = (ImDrawIdx)(vtx_idx + 1); idx_write[2] = (ImDrawIdx)(vtx_idx + 2);
+                idx_write += 3;
+                vtx_idx += 3;
             }
 
-            // Add vertices
-            for (int i = 0; i < points_count; i++)
+            if (i > 0)
+            {
+                idx_write[0] = (ImDrawIdx)(prev_out_l); idx_write[1] = (ImDrawIdx)(in_l); idx_write[2] = (ImDrawIdx)(in_r);
+                idx_write[3] = (ImDrawIdx)(prev_out_l); idx_write[4] = (ImDrawIdx)(in_r); idx_write[5] = (ImDrawIdx)(prev_out_r);
+                idx_write += 6;
+            }
+            else
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
-                _VtxWritePtr += 4;
+                first_in_l = in_l;
+                first_in_r = in_r;
             }
+            prev_out_l = out_l;
+            prev_out_r = out_r;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        if (closed)
+        {
+            idx_write[0] = (ImDrawIdx)(prev_out_l); idx_write[1] = (ImDrawIdx)(first_in_l); idx_write[2] = (ImDrawIdx)(first_in_r);
+            idx_write[3] = (ImDrawIdx)(prev_out_l); idx_write[4] = (ImDrawIdx)(first_in_r); idx_write[5] = (ImDrawIdx)(prev_out_r);
+            idx_write += 6;
+        }
+
+        const int vtx_count = (int)(vtx_write - _VtxWritePtr);
+        const int idx_count = (int)(idx_write - _IdxWritePtr);
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = vtx_idx;
+        PrimUnreserve(idx_count_max - idx_count, vtx_count_max - vtx_count);
     }
     else
     {
@@ -1720,7 +1988,6 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
-    IM_UNUSED(draw_list);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
@@ -1729,6 +1996,8 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
         _Channels.resize(channels_count);
     }
     _Count = channels_count;
+    if (channels_count > 1)
+        draw_list->_SplitDepth++;
 
     // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
     // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
@@ -1745,6 +2014,13 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
             _Channels[i]._CmdBuffer.resize(0);
             _Channels[i]._IdxBuffer.resize(0);
         }
+
+        // Channels whose index buffer was linked into the draw list by the last Merge() get storage recycled from its previous IdxChunks[]
+        if (_Channels[i]._IdxBuffer.Capacity == 0 && draw_list->_IdxChunksFree.Size > 0)
+        {
+            memcpy(&_Channels[i]._IdxBuffer, &draw_list->_IdxChunksFree.back(), sizeof(ImVector<ImDrawIdx>));
+            draw_list->_IdxChunksFree.pop_back();
+        }
     }
 }
 
@@ -1757,6 +2033,12 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
+    // With ImDrawListFlags_AllowIdxChunks, index buffers of channels are moved into draw_list->IdxChunks[] instead of being copied.
+    // Not done while another splitter is split over the same draw list: our channel 0 is then one of its channels and not the draw list itself.
+    const bool link_idx_buffers = (draw_list->Flags & ImDrawListFlags_AllowIdxChunks) && draw_list->_SplitDepth == 1;
+    if (draw_list->_SplitDepth > 0)
+        draw_list->_SplitDepth--;
+
     // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
@@ -1776,14 +2058,16 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
             if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
             {
                 // Merge previous channel last draw command with current channel first draw command if matching.
+                // It is left empty instead of being erased, and skipped when writing commands below.
                 last_cmd->ElemCount += next_cmd->ElemCount;
                 idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
+                next_cmd->ElemCount = 0;
             }
         }
-        if (ch._CmdBuffer.Size > 0)
+        const int cmd_skip = (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.Data[0].ElemCount == 0 && ch._CmdBuffer.Data[0].UserCallback == NULL) ? 1 : 0;
+        if (ch._CmdBuffer.Size > cmd_skip)
             last_cmd = &ch._CmdBuffer.back();
-        new_cmd_buffer_count += ch._CmdBuffer.Size;
+        new_cmd_buffer_count += ch._CmdBuffer.Size - cmd_skip;
         new_idx_buffer_count += ch._IdxBuffer.Size;
         for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
         {
@@ -1792,16 +2076,35 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
         }
     }
     draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
-    draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+    if (!link_idx_buffers)
+        draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
 
     // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
+    // When linking, each non-empty channel index buffer becomes draw_list->IdxBuffer, the previous one being pushed to IdxChunks[].
     ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
-    ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - (link_idx_buffers ? 0 : new_idx_buffer_count);
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
-        if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+        const int cmd_skip = (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.Data[0].ElemCount == 0 && ch._CmdBuffer.Data[0].UserCallback == NULL) ? 1 : 0;
+        if (int sz = ch._CmdBuffer.Size - cmd_skip) { memcpy(cmd_write, ch._CmdBuffer.Data + cmd_skip, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        if (ch._IdxBuffer.Size == 0)
+            continue;
+        if (!link_idx_buffers)
+        {
+            memcpy(idx_write, ch._IdxBuffer.Data, ch._IdxBuffer.Size * sizeof(ImDrawIdx));
+            idx_write += ch._IdxBuffer.Size;
+            continue;
+        }
+        ImVector<ImDrawIdx>& prev_idx_buffer = draw_list->IdxBuffer;
+        if (prev_idx_buffer.Size > 0)
+            draw_list->IdxChunks.push_back(prev_idx_buffer);
+        else if (prev_idx_buffer.Capacity > 0)
+            draw_list->_IdxChunksFree.push_back(prev_idx_buffer);
+        draw_list->IdxChunksSize += prev_idx_buffer.Size;
+        memcpy(&draw_list->IdxBuffer, &ch._IdxBuffer, sizeof(ch._IdxBuffer));
+        memset(&ch._IdxBuffer, 0, sizeof(ch._IdxBuffer));
+        idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
     }
     draw_list->_IdxWritePtr = idx_write;
 
@@ -1855,6 +2158,7 @@ void ImDrawData::DeIndexAllBuffers()
     for (int i = 0; i < CmdListsCount; i++)
     {
         ImDrawList* cmd_list = CmdLists[i];
+        cmd_list->_FlattenIdxChunks();
         if (cmd_list->IdxBuffer.empty())
             continue;
         new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
@@ -2004,10 +2308,16 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
     { ImVec2(109,0),ImVec2(13,15), ImVec2( 6, 7) }, // ImGuiMouseCursor_NotAllowed
 };
 
+// Forward declarations (ImFontAtlasFlags_DynamicGlyphs)
+static void ImFontAtlasBuildDestroyDynamicGlyphs(ImFontAtlas* atlas);
+static const ImFontGlyph* ImFontAtlasBuildLoadDynamicGlyph(ImFontAtlas* atlas, ImFont* font, ImFontGlyph* glyph);
+static void ImFontSetupGlyph(ImFont* font, ImFontGlyph* glyph, const ImFontConfig* cfg, ImWchar codepoint, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
+
 ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
     TexGlyphPadding = 1;
+    TexSdfSpread = 4;
     PackIdMouseCursors = PackIdLines = -1;
 }
 
@@ -2020,6 +2330,7 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildDestroyDynamicGlyphs(this);
     for (int i = 0; i < ConfigData.Size; i++)
         if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
         {
@@ -2043,6 +2354,7 @@ void    ImFontAtlas::ClearInputData()
 void    ImFontAtlas::ClearTexData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildDestroyDynamicGlyphs(this);
     if (TexPixelsAlpha8)
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
@@ -2050,12 +2362,14 @@ void    ImFontAtlas::ClearTexData()
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
     TexPixelsUseColors = false;
+    TexDirtyRects.clear();
     // Important: we leave TexReady untouched
 }
 
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildDestroyDynamicGlyphs(this);
     Fonts.clear_delete();
     TexReady = false;
 }
@@ -2318,6 +2632,296 @@ bool    ImFontAtlas::Build()
     return builder_io->FontBuilder_Build(this);
 }
 
+// Build cache data layout. Bump FONT_ATLAS_BUILD_CACHE_VERSION when changing what SaveBuildCacheToMemory() writes.
+static const ImU32 FONT_ATLAS_BUILD_CACHE_MAGIC = 0x43464D49; // "IMFC"
+static const ImU32 FONT_ATLAS_BUILD_CACHE_VERSION = 2;
+
+struct ImFontAtlasBuildCacheHeader
+{
+    ImU32           Magic;
+    ImU32           Version;
+    ImU32           InputHash;          // See ImFontAtlasBuildCalcCacheInputHash()
+    ImU32           DataHash;           // See ImFontAtlasBuildCalcCacheDataHash()
+    int             TexWidth, TexHeight;
+    int             HasPixelsAlpha8, HasPixelsRGBA32;
+    int             PackIdMouseCursors, PackIdLines;
+    ImVec2          TexUvWhitePixel;
+    ImVec4          TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+    // Followed by: CustomRects[] positions, pixels, then for each font: ImFontBuildCacheFont, Glyphs[], IndexAdvanceX[], IndexLookup[]
+};
+
+struct ImFontBuildCacheFont
+{
+    float           FontSize, Ascent, Descent, FallbackAdvanceX;
+    int             MetricsTotalSurface;
+    int             FallbackGlyphIndex; // Index into Glyphs[], -1 if none
+    ImWchar         FallbackChar, EllipsisChar, DotChar;
+    ImU8            Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8];
+};
+
+struct ImFontAtlasBuildCacheWriter
+{
+    ImVector<unsigned char>* Out;
+
+    void Write(const void* data, size_t size)   { int offset = Out->Size; Out->resize(offset + (int)size); memcpy(Out->Data + offset, data, size); }
+    template<typename T> void WriteVector(const ImVector<T>& v) { Write(&v.Size, sizeof(int)); Write(v.Data, (size_t)v.size_in_bytes()); }
+};
+
+struct ImFontAtlasBuildCacheReader
+{
+    const unsigned char* Ptr;
+    const unsigned char* End;
+
+    bool Read(void* data, size_t size)          { if ((size_t)(End - Ptr) < size) return false; memcpy(data, Ptr, size); Ptr += size; return true; }
+    template<typename T> bool ReadVector(ImVector<T>* v)
+    {
+        int size = 0;
+        if (!Read(&size, sizeof(int)) || size < 0 || (size_t)(End - Ptr) / sizeof(T) < (size_t)size)
+            return false;
+        v->resize(size);
+        return Read(v->Data, (size_t)v->size_in_bytes());
+    }
+};
+
+// Hash font data 16 bytes per step (same rounds as xxHash32), ImHashData() processes 1 byte per step and would take most of the time of loading a build cache.
+static ImU32 ImFontAtlasBuildHashFontData(const void* data, size_t data_size, ImU32 seed)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    ImU32 lanes[4] = { seed + 0x24234428, seed + 0x85EBCA77, seed, seed - 0x9E3779B1 };
+    for (; data_size >= 16; data_size -= 16, p += 16)
+        for (int lane_n = 0; lane_n < 4; lane_n++)
+        {
+            ImU32 k;
+            memcpy(&k, p + lane_n * 4, 4);
+            ImU32 h = lanes[lane_n] + k * 0x85EBCA77;
+            lanes[lane_n] = ((h << 13) | (h >> 19)) * 0x9E3779B1;
+        }
+    return ImHashData(p, data_size, ImHashData(lanes, sizeof(lanes), seed));
+}
+
+// Hash everything the output of Build() depends on, so a build cache is rejected as soon as fonts or settings changed.
+// Pointers (e.g. ImFontConfig::DstFont) are hashed as indices as they change across runs. This is called after ImFontAtlasBuildInit() registered its custom rects.
+static ImU32 ImFontAtlasBuildCalcCacheInputHash(const ImFontAtlas* atlas)
+{
+    const int layout[] = { IMGUI_VERSION_NUM, (int)sizeof(ImWchar), (int)sizeof(ImFontGlyph), IM_DRAWLIST_TEX_LINES_WIDTH_MAX, FONT_ATLAS_DEFAULT_TEX_DATA_W, FONT_ATLAS_DEFAULT_TEX_DATA_H };
+    ImU32 hash = ImHashData(layout, sizeof(layout));
+#ifdef IMGUI_ENABLE_FREETYPE
+    hash = ImHashStr("FreeType", 0, hash);
+#endif
+    const int atlas_settings[] = { atlas->Flags, atlas->TexDesiredWidth, atlas->TexGlyphPadding, atlas->TexSdfSpread, atlas->FontBuilderIO != NULL, (int)atlas->FontBuilderFlags, atlas->Fonts.Size, atlas->ConfigData.Size, atlas->CustomRects.Size };
+    hash = ImHashData(atlas_settings, sizeof(atlas_settings), hash);
+    for (int cfg_i = 0; cfg_i < atlas->ConfigData.Size; cfg_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[cfg_i];
+        int ranges_size = 0;
+        if (cfg.GlyphRanges)
+            while (cfg.GlyphRanges[ranges_size])
+                ranges_size++;
+        const int cfg_settings_i[] = { cfg.FontDataSize, cfg.FontNo, cfg.OversampleH, cfg.OversampleV, cfg.PixelSnapH, cfg.MergeMode, (int)cfg.FontBuilderFlags, (int)cfg.EllipsisChar, atlas->Fonts.index_from_ptr(atlas->Fonts.find(cfg.DstFont)), ranges_size };
+        const float cfg_settings_f[] = { cfg.SizePixels, cfg.GlyphExtraSpacing.x, cfg.GlyphExtraSpacing.y, cfg.GlyphOffset.x, cfg.GlyphOffset.y, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX, cfg.RasterizerMultiply };
+        hash = ImHashData(cfg_settings_i, sizeof(cfg_settings_i), hash);
+        hash = ImHashData(cfg_settings_f, sizeof(cfg_settings_f), hash);
+        hash = ImHashData(cfg.GlyphRanges, ranges_size * sizeof(ImWchar), hash);
+        hash = ImFontAtlasBuildHashFontData(cfg.FontData, (size_t)cfg.FontDataSize, hash);
+    }
+    for (int rect_i = 0; rect_i < atlas->CustomRects.Size; rect_i++)
+    {
+        const ImFontAtlasCustomRect& r = atlas->CustomRects[rect_i];
+        const int rect_settings_i[] = { r.Width, r.Height, (int)r.GlyphID, r.Font ? atlas->Fonts.index_from_ptr(atlas->Fonts.find(r.Font)) : -1 };
+        const float rect_settings_f[] = { r.GlyphAdvanceX, r.GlyphOffset.x, r.GlyphOffset.y };
+        hash = ImHashData(rect_settings_i, sizeof(rect_settings_i), hash);
+        hash = ImHashData(rect_settings_f, sizeof(rect_settings_f), hash);
+    }
+    return hash;
+}
+
+// Hash the whole build cache data (header with DataHash cleared, then everything following it), so damaged files are rejected.
+static ImU32 ImFontAtlasBuildCalcCacheDataHash(const ImFontAtlasBuildCacheHeader& header, const unsigned char* data, size_t data_size)
+{
+    ImFontAtlasBuildCacheHeader header_copy = header;
+    header_copy.DataHash = 0;
+    return ImFontAtlasBuildHashFontData(data, data_size, ImHashData(&header_copy, sizeof(header_copy)));
+}
+
+bool    ImFontAtlas::LoadBuildCacheFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (Flags & ImFontAtlasFlags_DynamicGlyphs)
+        return false;
+
+    // Register the same inputs as Build() does before hashing them
+    if (ConfigData.Size == 0)
+        AddFontDefault();
+    ImFontAtlasBuildInit(this);
+
+    ImFontAtlasBuildCacheReader reader = { (const unsigned char*)data, (const unsigned char*)data + data_size };
+    ImFontAtlasBuildCacheHeader header;
+    if (!reader.Read(&header, sizeof(header)) || header.Magic != FONT_ATLAS_BUILD_CACHE_MAGIC || header.Version != FONT_ATLAS_BUILD_CACHE_VERSION)
+        return false;
+    if (header.InputHash != ImFontAtlasBuildCalcCacheInputHash(this) || header.DataHash != ImFontAtlasBuildCalcCacheDataHash(header, reader.Ptr, (size_t)(reader.End - reader.Ptr)))
+        return false;
+
+    // Check sizes and indices before using them, the hash doesn't protect against crafted data
+    const size_t pixels_bytes_per_texel = (header.HasPixelsAlpha8 ? 1 : 0) + (header.HasPixelsRGBA32 ? 4 : 0);
+    if (header.TexWidth <= 0 || header.TexHeight <= 0 || header.TexWidth > 0x8000 || header.TexHeight > 0x8000 || pixels_bytes_per_texel == 0)
+        return false;
+    if ((size_t)(reader.End - reader.Ptr) / pixels_bytes_per_texel / (size_t)header.TexWidth < (size_t)header.TexHeight)
+        return false;
+    if (header.PackIdMouseCursors < -1 || header.PackIdMouseCursors >= CustomRects.Size || header.PackIdLines < -1 || header.PackIdLines >= CustomRects.Size)
+        return false;
+
+    // Texture
+    ClearTexData();
+    TexID = (ImTextureID)NULL;
+    TexReady = false;
+    TexWidth = header.TexWidth;
+    TexHeight = header.TexHeight;
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    TexUvWhitePixel = header.TexUvWhitePixel;
+    memcpy(TexUvLines, header.TexUvLines, sizeof(TexUvLines));
+    PackIdMouseCursors = header.PackIdMouseCursors;
+    PackIdLines = header.PackIdLines;
+    TexPixelsUseColors = header.HasPixelsRGBA32 != 0;
+    bool ok = true;
+    for (int rect_i = 0; rect_i < CustomRects.Size && ok; rect_i++)
+    {
+        ImFontAtlasCustomRect& r = CustomRects[rect_i];
+        ok = reader.Read(&r.X, sizeof(unsigned short)) && reader.Read(&r.Y, sizeof(unsigned short));
+        ok = ok && (!r.IsPacked() || (r.X + r.Width <= TexWidth && r.Y + r.Height <= TexHeight));
+    }
+    const size_t pixels_count = (size_t)TexWidth * (size_t)TexHeight;
+    if (ok && header.HasPixelsAlpha8)
+    {
+        TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(pixels_count);
+        ok = reader.Read(TexPixelsAlpha8, pixels_count);
+    }
+    if (ok && header.HasPixelsRGBA32)
+    {
+        TexPixelsRGBA32 = (unsigned int*)IM_ALLOC(pixels_count * 4);
+        ok = reader.Read(TexPixelsRGBA32, pixels_count * 4);
+    }
+
+    // Fonts (same setup as Build(), the metrics are then overwritten)
+    for (int cfg_i = 0; cfg_i < ConfigData.Size; cfg_i++)
+        ImFontAtlasBuildSetupFont(this, ConfigData[cfg_i].DstFont, &ConfigData[cfg_i], 0.0f, 0.0f);
+    for (int font_i = 0; font_i < Fonts.Size && ok; font_i++)
+    {
+        ImFont* font = Fonts[font_i];
+        ImFontBuildCacheFont font_data;
+        ok = reader.Read(&font_data, sizeof(font_data)) && reader.ReadVector(&font->Glyphs) && reader.ReadVector(&font->IndexAdvanceX) && reader.ReadVector(&font->IndexLookup);
+        ok = ok && font_data.FallbackGlyphIndex >= -1 && font_data.FallbackGlyphIndex < font->Glyphs.Size && font->IndexAdvanceX.Size == font->IndexLookup.Size;
+        for (int lookup_i = 0; lookup_i < font->IndexLookup.Size && ok; lookup_i++)
+            ok = (font->IndexLookup[lookup_i] == (ImWchar)-1 || (unsigned int)font->IndexLookup[lookup_i] < (unsigned int)font->Glyphs.Size);
+        if (!ok)
+            break;
+        font->FontSize = font_data.FontSize;
+        font->Ascent = font_data.Ascent;
+        font->Descent = font_data.Descent;
+        font->FallbackAdvanceX = font_data.FallbackAdvanceX;
+        font->MetricsTotalSurface = font_data.MetricsTotalSurface;
+        font->FallbackGlyph = (font_data.FallbackGlyphIndex >= 0) ? &font->Glyphs[font_data.FallbackGlyphIndex] : NULL;
+        font->FallbackChar = font_data.FallbackChar;
+        font->EllipsisChar = font_data.EllipsisChar;
+        font->DotChar = font_data.DotChar;
+        memcpy(font->Used4kPagesMap, font_data.Used4kPagesMap, sizeof(font->Used4kPagesMap));
+        font->DirtyLookupTables = false;
+    }
+
+    // Corrupted data: leave the atlas as if it was never built
+    if (!ok || reader.Ptr != reader.End)
+    {
+        ClearTexData();
+        for (int font_i = 0; font_i < Fonts.Size; font_i++)
+            Fonts[font_i]->ClearOutputData();
+        return false;
+    }
+    TexReady = true;
+    return true;
+}
+
+bool    ImFontAtlas::LoadBuildCacheFromDisk(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    if (!data)
+        return false;
+    const bool ret = LoadBuildCacheFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
+}
+
+bool    ImFontAtlas::SaveBuildCacheToMemory(ImVector<unsigned char>* out_data)
+{
+    out_data->resize(0);
+    if (!IsBuilt() || (TexPixelsAlpha8 == NULL && TexPixelsRGBA32 == NULL) || (Flags & ImFontAtlasFlags_DynamicGlyphs))
+        return false;
+
+    // RGBA32 pixels are only saved when they can't be converted back from Alpha8 pixels
+    ImFontAtlasBuildCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    header.Magic = FONT_ATLAS_BUILD_CACHE_MAGIC;
+    header.Version = FONT_ATLAS_BUILD_CACHE_VERSION;
+    header.InputHash = ImFontAtlasBuildCalcCacheInputHash(this);
+    header.TexWidth = TexWidth;
+    header.TexHeight = TexHeight;
+    header.HasPixelsAlpha8 = (TexPixelsAlpha8 != NULL);
+    header.HasPixelsRGBA32 = (TexPixelsRGBA32 != NULL && (TexPixelsUseColors || TexPixelsAlpha8 == NULL));
+    header.PackIdMouseCursors = PackIdMouseCursors;
+    header.PackIdLines = PackIdLines;
+    header.TexUvWhitePixel = TexUvWhitePixel;
+    memcpy(header.TexUvLines, TexUvLines, sizeof(TexUvLines));
+
+    const size_t pixels_count = (size_t)TexWidth * (size_t)TexHeight;
+    out_data->reserve((int)(sizeof(header) + pixels_count * (header.HasPixelsAlpha8 ? 1 : 4)));
+    ImFontAtlasBuildCacheWriter writer = { out_data };
+    writer.Write(&header, sizeof(header));
+    for (int rect_i = 0; rect_i < CustomRects.Size; rect_i++)
+    {
+        writer.Write(&CustomRects[rect_i].X, sizeof(unsigned short));
+        writer.Write(&CustomRects[rect_i].Y, sizeof(unsigned short));
+    }
+    if (header.HasPixelsAlpha8)
+        writer.Write(TexPixelsAlpha8, pixels_count);
+    if (header.HasPixelsRGBA32)
+        writer.Write(TexPixelsRGBA32, pixels_count * 4);
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        const ImFont* font = Fonts[font_i];
+        ImFontBuildCacheFont font_data;
+        memset(&font_data, 0, sizeof(font_data));
+        font_data.FontSize = font->FontSize;
+        font_data.Ascent = font->Ascent;
+        font_data.Descent = font->Descent;
+        font_data.FallbackAdvanceX = font->FallbackAdvanceX;
+        font_data.MetricsTotalSurface = font->MetricsTotalSurface;
+        font_data.FallbackGlyphIndex = font->FallbackGlyph ? (int)(font->FallbackGlyph - font->Glyphs.Data) : -1;
+        font_data.FallbackChar = font->FallbackChar;
+        font_data.EllipsisChar = font->EllipsisChar;
+        font_data.DotChar = font->DotChar;
+        memcpy(font_data.Used4kPagesMap, font->Used4kPagesMap, sizeof(font_data.Used4kPagesMap));
+        writer.Write(&font_data, sizeof(font_data));
+        writer.WriteVector(font->Glyphs);
+        writer.WriteVector(font->IndexAdvanceX);
+        writer.WriteVector(font->IndexLookup);
+    }
+    header.DataHash = ImFontAtlasBuildCalcCacheDataHash(header, out_data->Data + sizeof(header), (size_t)out_data->Size - sizeof(header));
+    memcpy(out_data->Data + IM_OFFSETOF(ImFontAtlasBuildCacheHeader, DataHash), &header.DataHash, sizeof(header.DataHash));
+    return true;
+}
+
+bool    ImFontAtlas::SaveBuildCacheToDisk(const char* filename)
+{
+    ImVector<unsigned char> data;
+    if (!SaveBuildCacheToMemory(&data))
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = (ImFileWrite(data.Data, 1, (ImU64)data.Size, f) == (ImU64)data.Size);
+    ImFileClose(f);
+    return ret;
+}
+
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
 {
     for (unsigned int i = 0; i < 256; i++)
@@ -2348,7 +2952,9 @@ struct ImFontBuildSrcData
     int                 DstIndex;           // Index into atlas->Fonts[] and dst_tmp_array[]
     int                 GlyphsHighest;      // Highest requested codepoint
     int                 GlyphsCount;        // Glyph count (excluding missing glyphs and glyphs already set by an earlier source font)
+    int                 GlyphsOffset;       // Index of our first glyph in the Rects/PackedChars buffers shared by all source fonts
     ImBitVector         GlyphsSet;          // Glyph bit map (random access, 1-bit per codepoint. This will be a maximum of 8KB)
+    ImBitVector         GlyphsAvail;        // Requested codepoints which are present in the font data (1-bit per codepoint)
     ImVector<int>       GlyphsList;         // Glyph codepoints list (flattened version of GlyphsMap)
 };
 
@@ -2361,6 +2967,36 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// Data kept after building for one source font, to rasterize its glyphs on demand (ImFontAtlasFlags_DynamicGlyphs)
+struct ImFontBuildDynamicSrcData
+{
+    stbtt_fontinfo      FontInfo;
+    float               Scale;              // Scale used for packing (see stbtt_PackFontRangesGatherRects)
+    int                 GlyphsCount;        // Glyphs registered by Build() and not rasterized yet
+    ImBitVector         GlyphsSet;          // Codepoints registered by Build() and not rasterized yet
+};
+
+struct ImFontBuildDynamicPendingGlyph
+{
+    ImFont*             Font;
+    ImFontGlyph*        Glyph;
+    int                 RectW, RectH;       // Size of the rectangle to pack, including padding
+};
+
+// Builder state stored in ImFontAtlas::DynamicGlyphsData
+struct ImFontBuildDynamicData
+{
+    stbtt_pack_context  PackContext;        // Packing continues in the free space left by Build()
+    ImVector<ImFontBuildDynamicSrcData> Srcs; // Indexed like atlas->ConfigData[]
+    ImVector<ImFontBuildDynamicPendingGlyph> PendingGlyphs; // Glyphs which didn't fit in the texture during this frame
+};
+
+// Glyphs rasterized by Build() with ImFontAtlasFlags_DynamicGlyphs: ASCII, and candidates for fallback and ellipsis characters (see ImFont::BuildLookupTable())
+static bool ImFontAtlasBuildIsGlyphPreloaded(const ImFont* font, unsigned int codepoint)
+{
+    return codepoint < 0x80 || codepoint == IM_UNICODE_CODEPOINT_INVALID || codepoint == 0x2026 || codepoint == 0x0085 || codepoint == font->FallbackChar || codepoint == font->EllipsisChar;
+}
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2373,10 +3009,182 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+// Size of the texture rectangle needed by a glyph, including padding (this is based on stbtt_PackFontRangesGatherRects, or stbtt_GetGlyphSDF with ImFontAtlasFlags_SignedDistanceField)
+static void ImFontAtlasBuildCalcGlyphRectSize(const ImFontAtlas* atlas, const ImFontConfig* cfg, const stbtt_fontinfo* font_info, int glyph_index, float scale, stbrp_rect* rect)
+{
+    int x0, y0, x1, y1;
+    if (atlas->Flags & ImFontAtlasFlags_SignedDistanceField)
+    {
+        stbtt_GetGlyphBitmapBoxSubpixel(font_info, glyph_index, scale, scale, 0, 0, &x0, &y0, &x1, &y1);
+        const int spread = (x0 != x1 && y0 != y1) ? atlas->TexSdfSpread : 0; // Empty glyphs have no distance field
+        rect->w = (stbrp_coord)(x1 - x0 + spread * 2 + atlas->TexGlyphPadding);
+        rect->h = (stbrp_coord)(y1 - y0 + spread * 2 + atlas->TexGlyphPadding);
+    }
+    else
+    {
+        stbtt_GetGlyphBitmapBoxSubpixel(font_info, glyph_index, scale * cfg->OversampleH, scale * cfg->OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+        rect->w = (stbrp_coord)(x1 - x0 + atlas->TexGlyphPadding + cfg->OversampleH - 1);
+        rect->h = (stbrp_coord)(y1 - y0 + atlas->TexGlyphPadding + cfg->OversampleV - 1);
+    }
+}
+
+// Rasterize a glyph as a signed distance field into its packed rectangle, and output its packed char data as stbtt_PackFontRangesRenderIntoRects() does (ImFontAtlasFlags_SignedDistanceField)
+// Distances up to TexSdfSpread pixels from the edge are mapped to 0..255 with the edge at 128, increasing toward the inside of the glyph.
+static void ImFontAtlasBuildRenderSdfGlyph(ImFontAtlas* atlas, const stbtt_fontinfo* font_info, int glyph_index, float scale, const stbrp_rect* rect, stbtt_packedchar* pc)
+{
+    int w = 0, h = 0, x_off = 0, y_off = 0;
+    if (unsigned char* sdf = stbtt_GetGlyphSDF(font_info, scale, glyph_index, atlas->TexSdfSpread, 128, 128.0f / atlas->TexSdfSpread, &w, &h, &x_off, &y_off))
+    {
+        IM_ASSERT(w + atlas->TexGlyphPadding <= rect->w && h + atlas->TexGlyphPadding <= rect->h);
+        for (int y = 0; y < h; y++)
+            memcpy(atlas->TexPixelsAlpha8 + rect->x + (rect->y + y) * atlas->TexWidth, sdf + y * w, (size_t)w);
+        stbtt_FreeSDF(sdf, font_info->userdata);
+    }
+    int advance, lsb;
+    stbtt_GetGlyphHMetrics(font_info, glyph_index, &advance, &lsb);
+    pc->x0 = (unsigned short)rect->x;
+    pc->y0 = (unsigned short)rect->y;
+    pc->x1 = (unsigned short)(rect->x + w);
+    pc->y1 = (unsigned short)(rect->y + h);
+    pc->xoff = (float)x_off;
+    pc->yoff = (float)y_off;
+    pc->xoff2 = (float)(x_off + w);
+    pc->yoff2 = (float)(y_off + h);
+    pc->xadvance = scale * advance;
+}
+
+// Data shared by the jobs of ImFontAtlasBuildWithStbTruetype()
+struct ImFontBuildJobData
+{
+    ImFontAtlas*                Atlas;
+    ImFontBuildSrcData*         Srcs;
+    int                         SrcsCount;
+    const stbtt_pack_context*   PackContext;
+    void*                       StbAllocContext;    // Set as stbtt_fontinfo::userdata by the jobs (ImFontBuildThreadAllocator* on build threads)
+};
+
+typedef void (*ImFontBuildJobFunc)(const ImFontBuildJobData* job, int item_begin, int item_end);
+
+// Split items [0, items_count) into contiguous chunks of at least 'min_items_per_thread' items and run 'func' on each chunk, using up to ImFontAtlas::BuildThreadsCount threads.
+// Jobs only write to data owned by their items, so the output is the same whatever the number of threads.
+static void ImFontAtlasBuildParallelFor(ImFontBuildJobData* job, int items_count, int min_items_per_thread, ImFontBuildJobFunc func)
+{
+#ifdef IMGUI_ENABLE_THREADED_FONT_BUILD
+    const int THREADS_MAX = 32;
+    int threads_count = (job->Atlas->BuildThreadsCount > 0) ? job->Atlas->BuildThreadsCount : (int)std::thread::hardware_concurrency();
+    threads_count = ImMin(ImMin(threads_count, items_count / min_items_per_thread), THREADS_MAX);
+    if (threads_count > 1)
+    {
+        // Updating IO.MetricsActiveAllocations from several threads would be a data race: have stb_truetype call the allocator functions directly.
+        ImFontBuildThreadAllocator allocator;
+        ImGui::GetAllocatorFunctions(&allocator.AllocFunc, &allocator.FreeFunc, &allocator.UserData);
+        job->StbAllocContext = &allocator;
+
+        // The calling thread processes the first chunk
+        std::thread threads[THREADS_MAX];
+        for (int thread_n = 1; thread_n < threads_count; thread_n++)
+            threads[thread_n] = std::thread(func, job, items_count * thread_n / threads_count, items_count * (thread_n + 1) / threads_count);
+        func(job, 0, items_count / threads_count);
+        for (int thread_n = 1; thread_n < threads_count; thread_n++)
+            threads[thread_n].join();
+        job->StbAllocContext = NULL;
+        return;
+    }
+#else
+    IM_UNUSED(min_items_per_thread);
+#endif
+    func(job, 0, items_count);
+}
+
+// Find which requested codepoints are present in the font data, for sources [src_begin, src_end)
+static void ImFontAtlasBuildJobFindGlyphs(const ImFontBuildJobData* job, int src_begin, int src_end)
+{
+    for (int src_i = src_begin; src_i < src_end; src_i++)
+    {
+        ImFontBuildSrcData& src_tmp = job->Srcs[src_i];
+        for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
+            for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
+                if (stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))
+                    src_tmp.GlyphsAvail.SetBit(codepoint);
+    }
+}
+
+// Gather the sizes of the rectangles needed by glyphs [item_begin, item_end) (this loop is based on stbtt_PackFontRangesGatherRects)
+static void ImFontAtlasBuildJobCalcGlyphRects(const ImFontBuildJobData* job, int item_begin, int item_end)
+{
+    for (int src_i = 0; src_i < job->SrcsCount; src_i++)
+    {
+        ImFontBuildSrcData& src_tmp = job->Srcs[src_i];
+        const int glyph_begin = ImMax(item_begin - src_tmp.GlyphsOffset, 0);
+        const int glyph_end = ImMin(item_end - src_tmp.GlyphsOffset, src_tmp.GlyphsCount);
+        if (glyph_begin >= glyph_end)
+            continue;
+
+        const ImFontConfig& cfg = job->Atlas->ConfigData[src_i];
+        stbtt_fontinfo font_info = src_tmp.FontInfo;
+        font_info.userdata = job->StbAllocContext;
+        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&font_info, -cfg.SizePixels);
+        for (int glyph_i = glyph_begin; glyph_i < glyph_end; glyph_i++)
+        {
+            const int glyph_index_in_font = stbtt_FindGlyphIndex(&font_info, src_tmp.GlyphsList[glyph_i]);
+            IM_ASSERT(glyph_index_in_font != 0);
+            ImFontAtlasBuildCalcGlyphRectSize(job->Atlas, &cfg, &font_info, glyph_index_in_font, scale, &src_tmp.Rects[glyph_i]);
+        }
+    }
+}
+
+// Render/rasterize glyphs [item_begin, item_end) into the texture
+static void ImFontAtlasBuildJobRenderGlyphs(const ImFontBuildJobData* job, int item_begin, int item_end)
+{
+    ImFontAtlas* atlas = job->Atlas;
+    for (int src_i = 0; src_i < job->SrcsCount; src_i++)
+    {
+        ImFontBuildSrcData& src_tmp = job->Srcs[src_i];
+        const int glyph_begin = ImMax(item_begin - src_tmp.GlyphsOffset, 0);
+        const int glyph_end = ImMin(item_end - src_tmp.GlyphsOffset, src_tmp.GlyphsCount);
+        if (glyph_begin >= glyph_end)
+            continue;
+
+        const ImFontConfig& cfg = atlas->ConfigData[src_i];
+        stbtt_fontinfo font_info = src_tmp.FontInfo;
+        font_info.userdata = job->StbAllocContext;
+        if (atlas->Flags & ImFontAtlasFlags_SignedDistanceField)
+        {
+            const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&font_info, -cfg.SizePixels);
+            for (int glyph_i = glyph_begin; glyph_i < glyph_end; glyph_i++)
+                if (src_tmp.Rects[glyph_i].was_packed)
+                    ImFontAtlasBuildRenderSdfGlyph(atlas, &font_info, stbtt_FindGlyphIndex(&font_info, src_tmp.GlyphsList[glyph_i]), scale, &src_tmp.Rects[glyph_i], &src_tmp.PackedChars[glyph_i]);
+            continue;
+        }
+
+        // Work on copies, stbtt_PackFontRangesRenderIntoRects() temporarily writes the oversampling settings into the pack context
+        stbtt_pack_context spc = *job->PackContext;
+        stbtt_pack_range pack_range = src_tmp.PackRange;
+        pack_range.array_of_unicode_codepoints += glyph_begin;
+        pack_range.chardata_for_range += glyph_begin;
+        pack_range.num_chars = glyph_end - glyph_begin;
+        stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &pack_range, 1, &src_tmp.Rects[glyph_begin]);
+
+        // Apply multiply operator
+        if (cfg.RasterizerMultiply != 1.0f)
+        {
+            unsigned char multiply_table[256];
+            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+            for (int glyph_i = glyph_begin; glyph_i < glyph_end; glyph_i++)
+            {
+                const stbrp_rect* r = &src_tmp.Rects[glyph_i];
+                if (r->was_packed)
+                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            }
+        }
+    }
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
 
+    IM_ASSERT(!(atlas->Flags & ImFontAtlasFlags_SignedDistanceField) || atlas->TexSdfSpread > 0);
     ImFontAtlasBuildInit(atlas);
 
     // Clear atlas
@@ -2426,12 +3234,41 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         dst_tmp.GlyphsHighest = ImMax(dst_tmp.GlyphsHighest, src_tmp.GlyphsHighest);
     }
 
+    // With ImFontAtlasFlags_DynamicGlyphs, only a few glyphs are rasterized now, the others are kept aside to be rasterized the first time they are used.
+    ImFontBuildDynamicData* dyn_data = NULL;
+    if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+    {
+        dyn_data = IM_NEW(ImFontBuildDynamicData)();
+        dyn_data->Srcs.resize(src_tmp_array.Size);
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+            ImFontBuildDynamicSrcData& src_dyn = dyn_data->Srcs[src_i];
+            const ImFontConfig& cfg = atlas->ConfigData[src_i];
+            memset((void*)&src_dyn, 0, sizeof(src_dyn));
+            src_dyn.FontInfo = src_tmp.FontInfo;
+            src_dyn.Scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+            src_dyn.GlyphsSet.Create(src_tmp.GlyphsHighest + 1);
+        }
+    }
+
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
+    ImFontBuildJobData job;
+    memset(&job, 0, sizeof(job));
+    job.Atlas = atlas;
+    job.Srcs = src_tmp_array.Data;
+    job.SrcsCount = src_tmp_array.Size;
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].GlyphsAvail.Create(src_tmp_array[src_i].GlyphsHighest + 1);
+    ImFontAtlasBuildParallelFor(&job, src_tmp_array.Size, 1, ImFontAtlasBuildJobFindGlyphs);
+
     int total_glyphs_count = 0;
+    int dyn_glyphs_count = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
         ImFontBuildDstData& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
+        ImFontBuildDynamicSrcData* src_dyn = dyn_data ? &dyn_data->Srcs[src_i] : NULL;
         src_tmp.GlyphsSet.Create(src_tmp.GlyphsHighest + 1);
         if (dst_tmp.GlyphsSet.Storage.empty())
             dst_tmp.GlyphsSet.Create(dst_tmp.GlyphsHighest + 1);
@@ -2441,16 +3278,24 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             {
                 if (dst_tmp.GlyphsSet.TestBit(codepoint))    // Don't overwrite existing glyphs. We could make this an option for MergeMode (e.g. MergeOverwrite==true)
                     continue;
-                if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
+                if (!src_tmp.GlyphsAvail.TestBit(codepoint))    // It is actually in the font?
                     continue;
 
-                // Add to avail set/counters
-                src_tmp.GlyphsCount++;
+                // Add to avail set/counters (or to the set of glyphs to rasterize on first use)
                 dst_tmp.GlyphsCount++;
-                src_tmp.GlyphsSet.SetBit(codepoint);
                 dst_tmp.GlyphsSet.SetBit(codepoint);
+                if (src_dyn != NULL && !ImFontAtlasBuildIsGlyphPreloaded(atlas->ConfigData[src_i].DstFont, codepoint))
+                {
+                    src_dyn->GlyphsCount++;
+                    src_dyn->GlyphsSet.SetBit(codepoint);
+                    dyn_glyphs_count++;
+                    continue;
+                }
+                src_tmp.GlyphsCount++;
+                src_tmp.GlyphsSet.SetBit(codepoint);
                 total_glyphs_count++;
             }
+        src_tmp.GlyphsAvail.Clear();
     }
 
     // 3. Unpack our bit map into a flat list (we now have all the Unicode points that we know are requested _and_ available _and_ not overlapping another)
@@ -2482,6 +3327,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+        src_tmp.GlyphsOffset = buf_rects_out_n;
         if (src_tmp.GlyphsCount == 0)
             continue;
 
@@ -2499,25 +3345,19 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.chardata_for_range = src_tmp.PackedChars;
         src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
         src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
-
-        // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
-        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
-        const int padding = atlas->TexGlyphPadding;
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
-        {
-            int x0, y0, x1, y1;
-            const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
-            IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
-            total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
-        }
     }
 
+    // Gather the sizes of all rectangles we will need to pack
+    ImFontAtlasBuildParallelFor(&job, total_glyphs_count, 512, ImFontAtlasBuildJobCalcGlyphRects);
+    for (int glyph_i = 0; glyph_i < total_glyphs_count; glyph_i++)
+        total_surface += buf_rects[glyph_i].w * buf_rects[glyph_i].h;
+
     // We need a width for the skyline algorithm, any width!
     // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
     // User can override TexDesiredWidth and TexGlyphPadding if they wish, otherwise we use a simple heuristic to select the width based on expected surface.
+    // With ImFontAtlasFlags_DynamicGlyphs, we expect the surface used once all glyphs have been rasterized (the height will grow as needed).
+    if (dyn_glyphs_count > 0 && total_glyphs_count > 0)
+        total_surface += (int)((float)total_surface / total_glyphs_count * dyn_glyphs_count);
     const int surface_sqrt = (int)ImSqrt((float)total_surface) + 1;
     atlas->TexHeight = 0;
     if (atlas->TexDesiredWidth > 0)
@@ -2557,37 +3397,30 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    job.PackContext = &spc;
+    ImFontAtlasBuildParallelFor(&job, total_glyphs_count, (atlas->Flags & ImFontAtlasFlags_SignedDistanceField) ? 4 : 32, ImFontAtlasBuildJobRenderGlyphs);
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
+        src_tmp_array[src_i].Rects = NULL;
 
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
-        {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
-        }
-        src_tmp.Rects = NULL;
+    // End packing, or keep packing context to rasterize more glyphs in the free space of the texture (ImFontAtlasFlags_DynamicGlyphs)
+    if (dyn_data != NULL)
+    {
+        ((stbrp_context*)spc.pack_info)->height = atlas->TexHeight;
+        dyn_data->PackContext = spc;
+        atlas->DynamicGlyphsData = dyn_data;
+    }
+    else
+    {
+        stbtt_PackEnd(&spc);
     }
-
-    // End packing
-    stbtt_PackEnd(&spc);
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
+        ImFontBuildDynamicSrcData* src_dyn = dyn_data ? &dyn_data->Srcs[src_i] : NULL;
+        if (src_tmp.GlyphsCount == 0 && (src_dyn == NULL || src_dyn->GlyphsCount == 0))
             continue;
 
         // When merging fonts with MergeMode=true:
@@ -2616,12 +3449,29 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             stbtt_GetPackedQuad(src_tmp.PackedChars, atlas->TexWidth, atlas->TexHeight, glyph_i, &unused_x, &unused_y, &q, 0);
             dst_font->AddGlyph(&cfg, (ImWchar)codepoint, q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, pc.xadvance);
         }
+
+        // Register glyphs to rasterize on first use with their final advance, so text layout doesn't change once they are rasterized.
+        // Until then they have no size and negative UV (see ImFontAtlasBuildLoadDynamicGlyph()).
+        if (src_dyn != NULL && src_dyn->GlyphsCount > 0)
+            for (int codepoint = 0; codepoint <= src_tmp.GlyphsHighest; codepoint++)
+                if (src_dyn->GlyphsSet.TestBit(codepoint))
+                {
+                    int advance, lsb;
+                    stbtt_GetGlyphHMetrics(&src_dyn->FontInfo, stbtt_FindGlyphIndex(&src_dyn->FontInfo, codepoint), &advance, &lsb);
+                    dst_font->AddGlyph(&cfg, (ImWchar)codepoint, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f, -1.0f, -1.0f, -1.0f, src_dyn->Scale * advance);
+                }
     }
 
     // Cleanup
     src_tmp_array.clear_destruct();
 
     ImFontAtlasBuildFinish(atlas);
+
+    // Fallback glyphs are expected to be rasterized (they are unless the user selected another FallbackChar)
+    if (dyn_data != NULL)
+        for (int i = 0; i < atlas->Fonts.Size; i++)
+            if (atlas->Fonts[i]->FallbackGlyph != NULL && atlas->Fonts[i]->FallbackGlyph->U0 < 0.0f)
+                ImFontAtlasBuildLoadDynamicGlyph(atlas, atlas->Fonts[i], (ImFontGlyph*)atlas->Fonts[i]->FallbackGlyph);
     return true;
 }
 
@@ -2632,6 +3482,273 @@ const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
     return &io;
 }
 
+static void ImFontAtlasBuildDestroyDynamicGlyphs(ImFontAtlas* atlas)
+{
+    ImFontBuildDynamicData* dyn_data = (ImFontBuildDynamicData*)atlas->DynamicGlyphsData;
+    if (dyn_data == NULL)
+        return;
+    stbtt_PackEnd(&dyn_data->PackContext);
+    dyn_data->Srcs.clear_destruct();
+    IM_DELETE(dyn_data);
+    atlas->DynamicGlyphsData = NULL;
+}
+
+// Update TexPixelsRGBA32 from TexPixelsAlpha8 after rasterizing into it, and record the area for the backend to upload
+static void ImFontAtlasBuildAddDirtyRect(ImFontAtlas* atlas, int x, int y, int w, int h)
+{
+    if (atlas->TexPixelsRGBA32 != NULL)
+        for (int off_y = 0; off_y < h; off_y++)
+        {
+            const unsigned char* src = atlas->TexPixelsAlpha8 + x + (y + off_y) * atlas->TexWidth;
+            unsigned int* dst = atlas->TexPixelsRGBA32 + x + (y + off_y) * atlas->TexWidth;
+            for (int off_x = 0; off_x < w; off_x++)
+                dst[off_x] = IM_COL32(255, 255, 255, (unsigned int)src[off_x]);
+        }
+
+    // Merge with the previous rectangle when their union isn't much larger (e.g. glyphs packed next to each other)
+    if (atlas->TexDirtyRects.Size > 0)
+    {
+        ImFontAtlasDirtyRect& prev = atlas->TexDirtyRects.back();
+        const int x0 = ImMin(x, (int)prev.X), y0 = ImMin(y, (int)prev.Y);
+        const int x1 = ImMax(x + w, prev.X + prev.Width), y1 = ImMax(y + h, prev.Y + prev.Height);
+        if ((x1 - x0) * (y1 - y0) <= (w * h + prev.Width * prev.Height) * 2)
+        {
+            prev.X = (unsigned short)x0;
+            prev.Y = (unsigned short)y0;
+            prev.Width = (unsigned short)(x1 - x0);
+            prev.Height = (unsigned short)(y1 - y0);
+            return;
+        }
+    }
+    ImFontAtlasDirtyRect r;
+    r.X = (unsigned short)x;
+    r.Y = (unsigned short)y;
+    r.Width = (unsigned short)w;
+    r.Height = (unsigned short)h;
+    atlas->TexDirtyRects.push_back(r);
+}
+
+// Rasterize a glyph registered by Build() with ImFontAtlasFlags_DynamicGlyphs, the first time it is used (called by ImFont::FindGlyph()).
+// - Glyphs are packed in the free space of the texture. When it is full, the glyph is queued for ImFontAtlasBuildUpdateDynamicGlyphs()
+//   to grow the texture at the beginning of next frame, and stays invisible meanwhile.
+// - Glyphs not rasterized yet have U0 < 0. Glyphs queued also have U1 == -2.
+static const ImFontGlyph* ImFontAtlasBuildLoadDynamicGlyph(ImFontAtlas* atlas, ImFont* font, ImFontGlyph* glyph)
+{
+    ImFontBuildDynamicData* dyn_data = (ImFontBuildDynamicData*)atlas->DynamicGlyphsData;
+    if (dyn_data == NULL) // Input or texture data was cleared after building
+        return (font->FallbackGlyph != NULL && font->FallbackGlyph->U0 >= 0.0f) ? font->FallbackGlyph : glyph;
+    if (glyph->U1 == -2.0f)
+        return glyph;
+
+    // Find source font which registered this glyph (first one if multiple sources were merged, as Build() does)
+    const int codepoint = (int)glyph->Codepoint;
+    int src_i = 0;
+    for (; src_i < dyn_data->Srcs.Size; src_i++)
+    {
+        const ImBitVector& glyphs_set = dyn_data->Srcs[src_i].GlyphsSet;
+        if (atlas->ConfigData[src_i].DstFont == font && codepoint < (glyphs_set.Storage.Size << 5) && glyphs_set.TestBit(codepoint))
+            break;
+    }
+    if (src_i == dyn_data->Srcs.Size)
+        return glyph;
+    ImFontBuildDynamicSrcData& src_dyn = dyn_data->Srcs[src_i];
+    const ImFontConfig& cfg = atlas->ConfigData[src_i];
+
+    // Pack (same as ImFontAtlasBuildWithStbTruetype())
+    const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_dyn.FontInfo, codepoint);
+    stbrp_rect rect;
+    memset(&rect, 0, sizeof(rect));
+    ImFontAtlasBuildCalcGlyphRectSize(atlas, &cfg, &src_dyn.FontInfo, glyph_index_in_font, src_dyn.Scale, &rect);
+    stbrp_pack_rects((stbrp_context*)dyn_data->PackContext.pack_info, &rect, 1);
+    if (!rect.was_packed)
+    {
+        ImFontBuildDynamicPendingGlyph pending = { font, glyph, rect.w, rect.h };
+        dyn_data->PendingGlyphs.push_back(pending);
+        glyph->U1 = -2.0f;
+        return glyph;
+    }
+
+    // Rasterize
+    stbtt_packedchar pc;
+    if (atlas->Flags & ImFontAtlasFlags_SignedDistanceField)
+    {
+        ImFontAtlasBuildRenderSdfGlyph(atlas, &src_dyn.FontInfo, glyph_index_in_font, src_dyn.Scale, &rect, &pc);
+    }
+    else
+    {
+        stbtt_pack_range pack_range;
+        memset(&pack_range, 0, sizeof(pack_range));
+        pack_range.font_size = cfg.SizePixels;
+        pack_range.array_of_unicode_codepoints = (int*)&codepoint;
+        pack_range.num_chars = 1;
+        pack_range.chardata_for_range = &pc;
+        pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+        pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+        stbtt_PackFontRangesRenderIntoRects(&dyn_data->PackContext, &src_dyn.FontInfo, &pack_range, 1, &rect);
+        if (cfg.RasterizerMultiply != 1.0f)
+        {
+            unsigned char multiply_table[256];
+            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+            ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, rect.x, rect.y, rect.w, rect.h, atlas->TexWidth * 1);
+        }
+    }
+    ImFontAtlasBuildAddDirtyRect(atlas, rect.x, rect.y, rect.w, rect.h);
+
+    // Setup glyph (same as ImFontAtlasBuildWithStbTruetype())
+    stbtt_aligned_quad q;
+    float unused_x = 0.0f, unused_y = 0.0f;
+    stbtt_GetPackedQuad(&pc, atlas->TexWidth, atlas->TexHeight, 0, &unused_x, &unused_y, &q, 0);
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(font->Ascent);
+    ImFontSetupGlyph(font, glyph, &cfg, (ImWchar)codepoint, q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, pc.xadvance);
+    src_dyn.GlyphsSet.ClearBit(codepoint);
+    src_dyn.GlyphsCount--;
+    return glyph;
+}
+
+// Tallest glyphs first, as stbrp_pack_rects() does with a batch of rectangles: this packs much tighter than the order glyphs were requested in.
+static int IMGUI_CDECL ImFontBuildDynamicPendingGlyphComparerByHeight(const void* lhs, const void* rhs)
+{
+    const ImFontBuildDynamicPendingGlyph* a = (const ImFontBuildDynamicPendingGlyph*)lhs;
+    const ImFontBuildDynamicPendingGlyph* b = (const ImFontBuildDynamicPendingGlyph*)rhs;
+    if (a->RectH != b->RectH)
+        return (a->RectH > b->RectH) ? -1 : +1;
+    return (a->RectW > b->RectW) ? -1 : (a->RectW < b->RectW) ? +1 : 0;
+}
+
+// Map a node of 'src' packing context to the same node in 'dst' copy (see ImFontAtlasBuildDynamicGlyphsFit())
+static stbrp_node* ImFontAtlasBuildRemapPackNode(const stbrp_node* node, const stbrp_context* src, const stbrp_node* src_nodes, stbrp_context* dst, stbrp_node* dst_nodes)
+{
+    if (node == NULL)
+        return NULL;
+    if (node >= src_nodes && node < src_nodes + src->num_nodes)
+        return dst_nodes + (node - src_nodes);
+    return &dst->extra[node - src->extra];
+}
+
+// Pack the queued glyphs in a copy of the packing context with a taller texture, in the order ImFontAtlasBuildLoadDynamicGlyph() will pack them.
+// The skyline nodes are linked lists into the context's own node array and 'extra' nodes, so the copy has its pointers remapped.
+static bool ImFontAtlasBuildDynamicGlyphsFit(const ImFontBuildDynamicData* dyn_data, int tex_height, ImVector<stbrp_node>* tmp_nodes)
+{
+    const stbrp_context* src = (const stbrp_context*)dyn_data->PackContext.pack_info;
+    const stbrp_node* src_nodes = (const stbrp_node*)dyn_data->PackContext.nodes;
+    stbrp_context context = *src;
+    tmp_nodes->resize(src->num_nodes);
+    memcpy(tmp_nodes->Data, src_nodes, (size_t)tmp_nodes->size_in_bytes());
+    context.active_head = ImFontAtlasBuildRemapPackNode(context.active_head, src, src_nodes, &context, tmp_nodes->Data);
+    context.free_head = ImFontAtlasBuildRemapPackNode(context.free_head, src, src_nodes, &context, tmp_nodes->Data);
+    for (int n = 0; n < tmp_nodes->Size; n++)
+        (*tmp_nodes)[n].next = ImFontAtlasBuildRemapPackNode((*tmp_nodes)[n].next, src, src_nodes, &context, tmp_nodes->Data);
+    for (int n = 0; n < IM_ARRAYSIZE(context.extra); n++)
+        context.extra[n].next = ImFontAtlasBuildRemapPackNode(context.extra[n].next, src, src_nodes, &context, tmp_nodes->Data);
+    context.height = tex_height;
+
+    for (int n = 0; n < dyn_data->PendingGlyphs.Size; n++)
+    {
+        stbrp_rect rect;
+        memset(&rect, 0, sizeof(rect));
+        rect.w = (stbrp_coord)dyn_data->PendingGlyphs[n].RectW;
+        rect.h = (stbrp_coord)dyn_data->PendingGlyphs[n].RectH;
+        stbrp_pack_rects(&context, &rect, 1);
+        if (!rect.was_packed)
+            return false;
+    }
+    return true;
+}
+
+bool ImFontAtlasBuildUpdateDynamicGlyphs(ImFontAtlas* atlas)
+{
+    ImFontBuildDynamicData* dyn_data = (ImFontBuildDynamicData*)atlas->DynamicGlyphsData;
+    if (dyn_data == NULL || dyn_data->PendingGlyphs.Size == 0)
+        return false;
+
+    // Double texture height until all queued glyphs fit: more glyphs will come, but growing beyond that may waste as much memory as the atlas uses.
+    // Doubling lets us halve V coordinates of existing glyphs without any precision loss.
+    stbrp_context* pack_context = (stbrp_context*)dyn_data->PackContext.pack_info;
+    const int tex_height_max = 1024 * 32; // Same as ImFontAtlasBuildWithStbTruetype()
+    int new_height = atlas->TexHeight;
+    ImVector<stbrp_node> tmp_nodes;
+    ImQsort(dyn_data->PendingGlyphs.Data, (size_t)dyn_data->PendingGlyphs.Size, sizeof(ImFontBuildDynamicPendingGlyph), ImFontBuildDynamicPendingGlyphComparerByHeight);
+    while (new_height * 2 <= tex_height_max)
+    {
+        new_height *= 2;
+        if (ImFontAtlasBuildDynamicGlyphsFit(dyn_data, new_height, &tmp_nodes))
+            break;
+    }
+
+    ImVector<ImFontBuildDynamicPendingGlyph> pending_glyphs;
+    pending_glyphs.swap(dyn_data->PendingGlyphs);
+    if (new_height == atlas->TexHeight)
+        return false; // Can't grow anymore: queued glyphs stay invisible
+
+    // Grow pixel buffers (the backend will re-create its texture)
+    const int old_pixels_count = atlas->TexWidth * atlas->TexHeight;
+    const int new_pixels_count = atlas->TexWidth * new_height;
+    unsigned char* new_pixels_alpha8 = (unsigned char*)IM_ALLOC((size_t)new_pixels_count);
+    memcpy(new_pixels_alpha8, atlas->TexPixelsAlpha8, (size_t)old_pixels_count);
+    memset(new_pixels_alpha8 + old_pixels_count, 0, (size_t)(new_pixels_count - old_pixels_count));
+    IM_FREE(atlas->TexPixelsAlpha8);
+    atlas->TexPixelsAlpha8 = new_pixels_alpha8;
+    if (atlas->TexPixelsRGBA32 != NULL)
+    {
+        unsigned int* new_pixels_rgba32 = (unsigned int*)IM_ALLOC((size_t)new_pixels_count * 4);
+        memcpy(new_pixels_rgba32, atlas->TexPixelsRGBA32, (size_t)old_pixels_count * 4);
+        for (int n = old_pixels_count; n < new_pixels_count; n++)
+            new_pixels_rgba32[n] = IM_COL32(255, 255, 255, 0);
+        IM_FREE(atlas->TexPixelsRGBA32);
+        atlas->TexPixelsRGBA32 = new_pixels_rgba32;
+    }
+    atlas->TexDirtyRects.resize(0);
+
+    // Update texture coordinates
+    const float v_scale = (float)atlas->TexHeight / (float)new_height;
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImFont* font = atlas->Fonts[font_n];
+        for (int glyph_n = 0; glyph_n < font->Glyphs.Size; glyph_n++)
+        {
+            ImFontGlyph& glyph = font->Glyphs[glyph_n];
+            if (glyph.U0 >= 0.0f)
+            {
+                glyph.V0 *= v_scale;
+                glyph.V1 *= v_scale;
+            }
+        }
+    }
+    atlas->TexUvWhitePixel.y *= v_scale;
+    for (int n = 0; n < IM_ARRAYSIZE(atlas->TexUvLines); n++)
+    {
+        atlas->TexUvLines[n].y *= v_scale;
+        atlas->TexUvLines[n].w *= v_scale;
+    }
+    atlas->TexHeight = new_height;
+    atlas->TexUvScale.y = 1.0f / new_height;
+    pack_context->height = new_height;
+    dyn_data->PackContext.pixels = atlas->TexPixelsAlpha8;
+    dyn_data->PackContext.height = new_height;
+
+    // Rasterize queued glyphs
+    for (int n = 0; n < pending_glyphs.Size; n++)
+    {
+        pending_glyphs[n].Glyph->U1 = -1.0f;
+        ImFontAtlasBuildLoadDynamicGlyph(atlas, pending_glyphs[n].Font, pending_glyphs[n].Glyph);
+    }
+    return true;
+}
+
+bool ImFontAtlasBuildHasPendingGlyphs(const ImFontAtlas* atlas)
+{
+    const ImFontBuildDynamicData* dyn_data = (const ImFontBuildDynamicData*)atlas->DynamicGlyphsData;
+    return dyn_data != NULL && dyn_data->PendingGlyphs.Size > 0;
+}
+
+#else
+
+static void ImFontAtlasBuildDestroyDynamicGlyphs(ImFontAtlas*) {}
+static const ImFontGlyph* ImFontAtlasBuildLoadDynamicGlyph(ImFontAtlas*, ImFont*, ImFontGlyph* glyph) { return glyph; }
+bool ImFontAtlasBuildUpdateDynamicGlyphs(ImFontAtlas*) { return false; }
+bool ImFontAtlasBuildHasPendingGlyphs(const ImFontAtlas*) { return false; }
+
 #endif // IMGUI_ENABLE_STB_TRUETYPE
 
 void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
@@ -2801,6 +3918,9 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 
     // Register texture region for thick lines
     // The +2 here is to give space for the end caps, whilst height +1 is to accommodate the fact we have a zero-width row
+    // Baked lines rely on bilinear filtering of their edges, which a distance field shader would turn into aliased edges.
+    if (atlas->Flags & ImFontAtlasFlags_SignedDistanceField)
+        atlas->Flags |= ImFontAtlasFlags_NoBakedLines;
     if (atlas->PackIdLines < 0)
     {
         if (!(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
@@ -3283,6 +4403,13 @@ void ImFont::GrowIndex(int new_size)
 // Not to be mistaken with texture coordinates, which are held by u0/v0/u1/v1 in normalized format (0.0..1.0 on each texture axis).
 // 'cfg' is not necessarily == 'this->ConfigData' because multiple source fonts+configs can be used to build one target font.
 void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x)
+{
+    Glyphs.resize(Glyphs.Size + 1);
+    ImFontSetupGlyph(this, &Glyphs.back(), cfg, codepoint, x0, y0, x1, y1, u0, v0, u1, v1, advance_x);
+}
+
+// Shared by AddGlyph() and ImFontAtlasBuildLoadDynamicGlyph() which rasterizes glyphs registered by AddGlyph() with negative UV.
+static void ImFontSetupGlyph(ImFont* font, ImFontGlyph* glyph, const ImFontConfig* cfg, ImWchar codepoint, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x)
 {
     if (cfg != NULL)
     {
@@ -3304,26 +4431,26 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
         advance_x += cfg->GlyphExtraSpacing.x;
     }
 
-    Glyphs.resize(Glyphs.Size + 1);
-    ImFontGlyph& glyph = Glyphs.back();
-    glyph.Codepoint = (unsigned int)codepoint;
-    glyph.Visible = (x0 != x1) && (y0 != y1);
-    glyph.Colored = false;
-    glyph.X0 = x0;
-    glyph.Y0 = y0;
-    glyph.X1 = x1;
-    glyph.Y1 = y1;
-    glyph.U0 = u0;
-    glyph.V0 = v0;
-    glyph.U1 = u1;
-    glyph.V1 = v1;
-    glyph.AdvanceX = advance_x;
+    glyph->Codepoint = (unsigned int)codepoint;
+    glyph->Visible = (x0 != x1) && (y0 != y1);
+    glyph->Colored = false;
+    glyph->X0 = x0;
+    glyph->Y0 = y0;
+    glyph->X1 = x1;
+    glyph->Y1 = y1;
+    glyph->U0 = u0;
+    glyph->V0 = v0;
+    glyph->U1 = u1;
+    glyph->V1 = v1;
+    glyph->AdvanceX = advance_x;
 
     // Compute rough surface usage metrics (+1 to account for average padding, +0.99 to round)
     // We use (U1-U0)*TexWidth instead of X1-X0 to account for oversampling.
-    float pad = ContainerAtlas->TexGlyphPadding + 0.99f;
-    DirtyLookupTables = true;
-    MetricsTotalSurface += (int)((glyph.U1 - glyph.U0) * ContainerAtlas->TexWidth + pad) * (int)((glyph.V1 - glyph.V0) * ContainerAtlas->TexHeight + pad);
+    // Glyphs not rasterized yet (ImFontAtlasFlags_DynamicGlyphs) are accounted for once they are.
+    float pad = font->ContainerAtlas->TexGlyphPadding + 0.99f;
+    font->DirtyLookupTables = true;
+    if (u0 >= 0.0f)
+        font->MetricsTotalSurface += (int)((glyph->U1 - glyph->U0) * font->ContainerAtlas->TexWidth + pad) * (int)((glyph->V1 - glyph->V0) * font->ContainerAtlas->TexHeight + pad);
 }
 
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
@@ -3348,7 +4475,10 @@ const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
     const ImWchar i = IndexLookup.Data[c];
     if (i == (ImWchar)-1)
         return FallbackGlyph;
-    return &Glyphs.Data[i];
+    const ImFontGlyph* glyph = &Glyphs.Data[i];
+    if (glyph->U0 < 0.0f) // Rasterize on first use (ImFontAtlasFlags_DynamicGlyphs)
+        return ImFontAtlasBuildLoadDynamicGlyph(ContainerAtlas, (ImFont*)this, (ImFontGlyph*)glyph);
+    return glyph;
 }
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
@@ -3990,7 +5120,18 @@ static void stb__match(const unsigned char *data, unsigned int length)
     IM_ASSERT(stb__dout + length <= stb__barrier_out_e);
     if (stb__dout + length > stb__barrier_out_e) { stb__dout += length; return; }
     if (data < stb__barrier_out_b) { stb__dout = stb__barrier_out_e+1; return; }
-    while (length--) *stb__dout++ = *data++;
+    // Overlapping copies repeat the last (stb__dout - data) bytes: only those need to be copied one at a time.
+    // Copy through a local pointer, so the compiler doesn't reload/store stb__dout for each byte.
+    unsigned char* dout = stb__dout;
+    const size_t dist = (size_t)(dout - data);
+    if (dist >= length)
+        memcpy(dout, data, length);
+    else if (dist == 1)
+        memset(dout, *data, length);
+    else
+        for (unsigned int n = 0; n < length; n++)
+            dout[n] = data[n];
+    stb__dout = dout + length;
 }
 
 static void stb__lit(const unsigned char *data, unsigned int length)
@@ -60,6 +60,22 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+// Enable NEON intrinsics if requested and available (see IMGUI_USE_NEON in imconfig.h)
+// AArch64 only, as ARMv7 NEON lacks IEEE division/square root needed to match the scalar code paths.
+#if (defined __aarch64__ || defined _M_ARM64) && defined(IMGUI_USE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+// Enable hardware CRC32 instructions for ImHashData/ImHashStr if requested and available (see IMGUI_USE_HW_CRC32 in imconfig.h)
+#if defined(IMGUI_USE_HW_CRC32) && defined(__ARM_FEATURE_CRC32)
+#define IMGUI_ENABLE_ARM_CRC32
+#include <arm_acle.h>
+#elif defined(IMGUI_USE_HW_CRC32) && defined(__SSE4_2__)
+#define IMGUI_ENABLE_SSE42_CRC32
+#include <nmmintrin.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -142,6 +158,7 @@ struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
+struct ImGuiSettingsSaveJob;        // Background write of the .ini file (IMGUI_ENABLE_THREADED_INI_SAVE)
 
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
 typedef int ImGuiLayoutType;            // -> enum ImGuiLayoutType_         // Enum: Horizontal or vertical
@@ -174,6 +191,10 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // [SECTION] STB libraries includes
 //-------------------------------------------------------------------------
 
+#ifndef IMGUI_INPUT_TEXT_UNDO_MEMORY
+#define IMGUI_INPUT_TEXT_UNDO_MEMORY    (1024 * 1024)       // Max size in bytes of the undo/redo storage of the active InputText(), the oldest undo states are discarded past it.
+#endif
+
 namespace ImStb
 {
 
@@ -182,8 +203,11 @@ namespace ImStb
 #define STB_TEXTEDIT_STRING             ImGuiInputTextState
 #define STB_TEXTEDIT_CHARTYPE           ImWchar
 #define STB_TEXTEDIT_GETWIDTH_NEWLINE   (-1.0f)
-#define STB_TEXTEDIT_UNDOSTATECOUNT     99
-#define STB_TEXTEDIT_UNDOCHARCOUNT      999
+#define STB_TEXTEDIT_UNDOSTATECOUNT     99                  // Initial number of undo records, allocated on the first edit
+#define STB_TEXTEDIT_UNDOCHARCOUNT      999                 // Initial number of characters stored for undo, allocated on the first edit
+#define STB_TEXTEDIT_UNDOMEMORY         IMGUI_INPUT_TEXT_UNDO_MEMORY
+#define STB_TEXTEDIT_UNDO_MALLOC(_SIZE) IM_ALLOC(_SIZE)
+#define STB_TEXTEDIT_UNDO_FREE(_PTR)    IM_FREE(_PTR)
 #include "imstb_textedit.h"
 
 } // namespace ImStb
@@ -384,6 +408,7 @@ IMGUI_API bool              ImFileClose(ImFileHandle file);
 IMGUI_API ImU64             ImFileGetSize(ImFileHandle file);
 IMGUI_API ImU64             ImFileRead(void* data, ImU64 size, ImU64 count, ImFileHandle file);
 IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 count, ImFileHandle file);
+IMGUI_API bool              ImFileRename(const char* old_filename, const char* new_filename);
 #else
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
@@ -998,9 +1023,12 @@ struct IMGUI_API ImGuiInputTextState
     ImGuiID                 ID;                     // widget id owning the text state
     int                     CurLenW, CurLenA;       // we need to maintain our buffer length in both UTF-8 and wchar format. UTF-8 length is valid even if TextA is not.
     ImVector<ImWchar>       TextW;                  // edit buffer, we need to persist but can't guarantee the persistence of the user-provided buffer. so we copy into own buffer.
-    ImVector<char>          TextA;                  // temporary UTF8 buffer for callbacks and other operations. this is not updated in every code-path! size=capacity.
+    ImVector<char>          TextA;                  // UTF8 copy of TextW for display, callbacks and the user buffer. once valid, edits are applied to both buffers. size=capacity.
     ImVector<char>          InitialTextA;           // backup of end-user buffer at the time of focus (in UTF-8, unaltered)
     bool                    TextAIsValid;           // temporary UTF8 buffer is not initially valid before we make the widget active (until then we pull the data from user argument)
+    int                     LastPosW, LastPosA;     // last position converted by CalcUtf8Offset(), in wchar and UTF-8. edits happen near the cursor so we convert from there.
+    ImVector<int>           LineOffsetsW;           // start of each line in TextW, maintained along with edits for multi-line editing (empty when not built or invalidated)
+    ImVector<int>           LineOffsetsA;           // start of each line in UTF-8, same indices as LineOffsetsW
     int                     BufCapacityA;           // end-user buffer capacity
     float                   ScrollX;                // horizontal scrolling/offset
     ImStb::STB_TexteditState Stb;                   // state for stb_textedit.h
@@ -1011,11 +1039,15 @@ struct IMGUI_API ImGuiInputTextState
     ImGuiInputTextFlags     Flags;                  // copy of InputText() flags
 
     ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); }
-    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); }
+    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; OnTextRewritten(); CursorClamp(); }
+    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); LineOffsetsW.clear(); LineOffsetsA.clear(); TextAIsValid = false; IM_FREE(Stb.undostate.undo_rec); IM_FREE(Stb.undostate.undo_char); memset(&Stb.undostate, 0, sizeof(Stb.undostate)); }
     int         GetUndoAvailCount() const   { return Stb.undostate.undo_point; }
-    int         GetRedoAvailCount() const   { return STB_TEXTEDIT_UNDOSTATECOUNT - Stb.undostate.redo_point; }
+    int         GetRedoAvailCount() const   { return Stb.undostate.undo_rec_count - Stb.undostate.redo_point; }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
+    int         CalcUtf8Offset(int pos_w);  // Convert a TextW position to a byte offset in the UTF-8 text, only scanning from the nearest of start/end/last converted position
+    void        OnTextRewritten()           { LastPosW = LastPosA = 0; LineOffsetsW.resize(0); LineOffsetsA.resize(0); } // Call when TextW is rewritten without going through STB_TEXTEDIT_INSERTCHARS/DELETECHARS
+    void        BuildLineOffsets();         // Scan TextW for line starts, only needed after OnTextRewritten()
+    int         FindLineIndex(int pos_w) const; // Binary search the line containing a TextW position, requires LineOffsetsW to be built
 
     // Cursor & Selection
     void        CursorAnimReset()           { CursorAnim = -0.30f; }                                   // After a user-input the cursor stays on for a while without blinking
@@ -1150,6 +1182,35 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)  { Ptr = NULL; Index = index; }
 };
 
+// Text layout cache: results of CalcTextSize() and line breaks of RenderTextWrapped(), reused while the same text is submitted every frame.
+// - Set-associative: IMGUI_TEXT_LAYOUT_CACHE_SETS sets of IMGUI_TEXT_LAYOUT_CACHE_WAYS entries, the least recently used entry of a set is replaced.
+// - Entries are looked up by text pointer and length (cheaper than hashing the text), then contents are compared to a copy.
+// - Text copies and line offsets are limited to IMGUI_TEXT_LAYOUT_CACHE_MEMORY bytes: least recently used entries are released by NewFrame() past that.
+#ifndef IMGUI_TEXT_LAYOUT_CACHE_SETS
+#define IMGUI_TEXT_LAYOUT_CACHE_SETS    256                 // Must be a power of two. Set to 0 to disable the cache.
+#endif
+#ifndef IMGUI_TEXT_LAYOUT_CACHE_MEMORY
+#define IMGUI_TEXT_LAYOUT_CACHE_MEMORY  (4 * 1024 * 1024)   // Longer texts are measured directly
+#endif
+#define IMGUI_TEXT_LAYOUT_CACHE_WAYS    4
+#define IMGUI_TEXT_LAYOUT_CACHE_MIN_LEN 4                   // Shorter texts are measured directly
+
+struct ImGuiTextLayoutCacheEntry
+{
+    const char*             Text;               // Text pointer and length are part of the key, contents are compared with TextCopy
+    int                     TextLen;
+    ImFont*                 Font;
+    float                   FontSize;
+    float                   WrapWidth;
+    int                     LastFrameUsed;      // -1 when empty
+    bool                    HasSize;
+    bool                    HasLines;
+    ImVec2                  Size;               // CalcTextSize() result (already rounded)
+    ImVector<char>          TextCopy;
+    ImVector<int>           Lines;              // With WrapWidth > 0.0f: [begin, end) offsets of each line, as laid out by ImFont::RenderText(). With WrapWidth == 0.0f: lines split by TextEx() for long text.
+    float                   LinesWidth;         // With WrapWidth == 0.0f: widest of the lines above as measured by CalcTextSize() (-1.0f until measured)
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Inputs support
 //-----------------------------------------------------------------------------
@@ -1248,10 +1309,11 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    float                           ItemStartPosY;          // With a height index: cursor position before the item submitted by the last step, FLT_MAX if there is none to measure
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; ItemStartPosY = FLT_MAX; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -1457,6 +1519,8 @@ struct ImGuiWindowSettings
     ImVec2ih    Size;
     bool        Collapsed;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    int         IniTextOffset;  // Text of this entry in g.SettingsIniData, reused by the next save (see SettingsBeginWriteEntry())
+    int         IniTextSize;    // Size of the cached text, 0 when the entry needs to be formatted again
 
     ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); }
     char* GetName()             { return (char*)(this + 1); }
@@ -1581,6 +1645,8 @@ struct ImGuiContext
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
+    int                     WindowsCacheHitCount;               // Number of windows which reused their draw list this frame (ImGuiWindowFlags_CacheDrawList)
+    int                     WindowsCacheMissCount;
     ImVec2                  WindowsHoverPadding;                // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, WINDOWS_HOVER_PADDING)
     ImGuiWindow*            CurrentWindow;                      // Window being drawn into
     ImGuiWindow*            HoveredWindow;                      // Window the mouse is hovering. Will typically catch mouse inputs.
@@ -1763,18 +1829,38 @@ struct ImGuiContext
     ImVector<char>          ClipboardHandlerData;               // If no custom clipboard handler is defined
     ImVector<ImGuiID>       MenusIdSubmittedThisFrame;          // A list of menu IDs that were rendered at least once
 
+    // Idle frames (see IsLastFrameClean(), CanSkipFrame())
+    bool                    FrameHadInput;                      // Input was received or held during the current frame
+    bool                    FrameClean;                         // Set by Render()
+    ImGuiID                 FrameDrawDataHash;                  // Hash of the last frame draw data, 0 when not computed
+    ImVec2                  FrameCleanMousePos;                 // io.MousePos/io.DisplaySize when the last frame was rendered, to detect direct writes by the application
+    ImVec2                  FrameCleanDisplaySize;
+    int                     FramesSkipped;                      // Consecutive calls to CanSkipFrame() which returned true
+
     // Platform support
     ImGuiPlatformImeData    PlatformImeData;                    // Data updated by current frame
     ImGuiPlatformImeData    PlatformImeDataPrev;                // Previous frame data (when changing we will call io.SetPlatformImeDataFn
     char                    PlatformLocaleDecimalPoint;         // '.' or *localeconv()->decimal_point
 
+    // Text layout cache
+    ImVector<ImGuiTextLayoutCacheEntry> TextLayoutCache;        // IMGUI_TEXT_LAYOUT_CACHE_SETS * IMGUI_TEXT_LAYOUT_CACHE_WAYS entries, allocated on first use
+    ImU32                   TextLayoutCacheFontsStamp;          // Cache is cleared when the font atlas was rebuilt
+    bool                    TextLayoutCacheEntriesReplaced;     // Memory used by the cache is checked on next NewFrame()
+    int                     TextLayoutCacheHitCount;            // Number of text layouts reused this frame
+    int                     TextLayoutCacheMissCount;
+
     // Settings
     bool                    SettingsLoaded;
     float                   SettingsDirtyTimer;                 // Save .ini Settings to memory when time reaches zero
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
+    ImGuiTextBuffer         SettingsIniDataPrev;                // Output of the previous SaveIniSettingsToMemory() call, unchanged entries are copied from there
+    bool                    SettingsIniDataIsSaved;             // SettingsIniData holds the output of SaveIniSettingsToMemory() (as opposed to loaded/cleared data)
+    ImGuiSettingsSaveJob*   SettingsSaveJob;                    // Pending background write of the .ini file (IMGUI_ENABLE_THREADED_INI_SAVE)
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiStorage                        SettingsWindowsById;    // Map ImGuiWindowSettings::ID to its offset in SettingsWindows
+    ImGuiStorage                        SettingsTablesById;     // Map ImGuiTableSettings::ID to its offset in SettingsTables
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -1823,6 +1909,7 @@ struct ImGuiContext
         TestEngine = NULL;
 
         WindowsActiveCount = 0;
+        WindowsCacheHitCount = WindowsCacheMissCount = 0;
         CurrentWindow = NULL;
         HoveredWindow = NULL;
         HoveredWindowUnderMovingWindow = NULL;
@@ -1929,12 +2016,23 @@ struct ImGuiContext
         TooltipOverrideCount = 0;
         TooltipSlowDelay = 0.50f;
 
+        FrameHadInput = FrameClean = false;
+        FrameDrawDataHash = 0;
+        FrameCleanMousePos = FrameCleanDisplaySize = ImVec2(-FLT_MAX, -FLT_MAX);
+        FramesSkipped = 0;
+
         PlatformImeData.InputPos = ImVec2(0.0f, 0.0f);
         PlatformImeDataPrev.InputPos = ImVec2(-1.0f, -1.0f); // Different to ensure initial submission
         PlatformLocaleDecimalPoint = '.';
 
+        TextLayoutCacheFontsStamp = 0;
+        TextLayoutCacheEntriesReplaced = false;
+        TextLayoutCacheHitCount = TextLayoutCacheMissCount = 0;
+
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsIniDataIsSaved = false;
+        SettingsSaveJob = NULL;
         HookIdNext = 0;
 
         LogEnabled = false;
@@ -2102,6 +2200,14 @@ struct IMGUI_API ImGuiWindow
     ImGuiID                 NavLastIds[ImGuiNavLayer_COUNT];    // Last known NavId for this window, per layer (0/1)
     ImRect                  NavRectRel[ImGuiNavLayer_COUNT];    // Reference rectangle, in window relative space
 
+    bool                    DrawListCacheValid;                 // Draw list was built without interactions and can be reused (ImGuiWindowFlags_CacheDrawList)
+    bool                    DrawListCacheHit;                   // Draw list of last frame is reused, items are skipped
+    int                     DrawListCacheFrames;                // Number of consecutive frames reusing the draw list
+    ImGuiID                 DrawListCacheKey;                   // Hash of the state the draw list depends on, other than items (position, size, scroll, style, focus...)
+    ImVector<ImDrawCmd>     DrawListCacheCmdBuffer;             // While reusing the draw list: holds its buffers while Begin()/End() build into a scratch one. Otherwise: scratch buffers.
+    ImVector<ImDrawIdx>     DrawListCacheIdxBuffer;
+    ImVector<ImDrawVert>    DrawListCacheVtxBuffer;
+
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
@@ -2111,6 +2217,7 @@ public:
     ~ImGuiWindow();
 
     ImGuiID     GetID(const char* str, const char* str_end = NULL);
+    ImGuiID     GetID(ImStrv str);
     ImGuiID     GetID(const void* ptr);
     ImGuiID     GetID(int n);
     ImGuiID     GetIDNoKeepAlive(const char* str, const char* str_end = NULL);
@@ -2457,6 +2564,8 @@ struct ImGuiTableSettings
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    int                         IniTextOffset;          // Text of this entry in g.SettingsIniData, reused by the next save (see SettingsBeginWriteEntry())
+    int                         IniTextSize;            // Size of the cached text, 0 when the entry needs to be formatted again
 
     ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
@@ -2532,6 +2641,8 @@ namespace ImGui
     IMGUI_API ImGuiWindowSettings*  FindWindowSettings(ImGuiID id);
     IMGUI_API ImGuiWindowSettings*  FindOrCreateWindowSettings(const char* name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API bool                  SettingsBeginWriteEntry(ImGuiTextBuffer* buf, int* text_offset, int* text_size);
+    IMGUI_API void                  SettingsEndWriteEntry(ImGuiTextBuffer* buf, int* text_offset, int* text_size);
 
     // Scrolling
     IMGUI_API void          SetNextWindowScroll(const ImVec2& scroll); // Use -1.0f on one axis to leave as-is
@@ -2617,7 +2728,7 @@ namespace ImGui
     // Menus
     IMGUI_API bool          BeginViewportSideBar(const char* name, ImGuiViewport* viewport, ImGuiDir dir, float size, ImGuiWindowFlags window_flags);
     IMGUI_API bool          BeginMenuEx(const char* label, const char* icon, bool enabled = true);
-    IMGUI_API bool          MenuItemEx(const char* label, const char* icon, const char* shortcut = NULL, bool selected = false, bool enabled = true);
+    IMGUI_API bool          MenuItemEx(ImStrv label, const char* icon, ImStrv shortcut = ImStrv(), bool selected = false, bool enabled = true);
 
     // Combos
     IMGUI_API bool          BeginComboPopup(ImGuiID popup_id, const ImRect& bb, ImGuiComboFlags flags);
@@ -2755,7 +2866,7 @@ namespace ImGui
     // NB: All position are in absolute pixels coordinates (we are never using window coordinates internally)
     IMGUI_API void          RenderText(ImVec2 pos, const char* text, const char* text_end = NULL, bool hide_text_after_hash = true);
     IMGUI_API void          RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end, float wrap_width);
-    IMGUI_API void          RenderTextClipped(const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
+    IMGUI_API void          RenderTextClipped(const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL, bool hide_text_after_hash = true);
     IMGUI_API void          RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, float clip_max_x, float ellipsis_max_x, const char* text, const char* text_end, const ImVec2* text_size_if_known);
     IMGUI_API void          RenderFrame(ImVec2 p_min, ImVec2 p_max, ImU32 fill_col, bool border = true, float rounding = 0.0f);
@@ -2763,6 +2874,8 @@ namespace ImGui
     IMGUI_API void          RenderColorRectWithAlphaCheckerboard(ImDrawList* draw_list, ImVec2 p_min, ImVec2 p_max, ImU32 fill_col, float grid_step, ImVec2 grid_off, float rounding = 0.0f, ImDrawFlags flags = 0);
     IMGUI_API void          RenderNavHighlight(const ImRect& bb, ImGuiID id, ImGuiNavHighlightFlags flags = ImGuiNavHighlightFlags_TypeDefault); // Navigation highlight
     IMGUI_API const char*   FindRenderedTextEnd(const char* text, const char* text_end = NULL); // Find the optional ## from which we stop displaying text.
+    IMGUI_API void          CalcWrappedTextLines(ImFont* font, float size, const char* text, const char* text_end, float wrap_width, ImVector<int>* out_lines); // Lines of word-wrapped text as [begin, end) offsets pairs
+    IMGUI_API ImGuiTextLayoutCacheEntry* GetTextLayoutCacheEntry(const char* text, const char* text_end, float wrap_width); // Text layout cache lookup, NULL when the text isn't cached
     IMGUI_API void          RenderMouseCursor(ImVec2 pos, float scale, ImGuiMouseCursor mouse_cursor, ImU32 col_fill, ImU32 col_border, ImU32 col_shadow);
 
     // Render helpers (those functions don't access any ImGui state!)
@@ -2781,7 +2894,7 @@ namespace ImGui
 
     // Widgets
     IMGUI_API void          TextEx(const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
-    IMGUI_API bool          ButtonEx(const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
+    IMGUI_API bool          ButtonEx(ImStrv label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
     IMGUI_API bool          CloseButton(ImGuiID id, const ImVec2& pos);
     IMGUI_API bool          CollapseButton(ImGuiID id, const ImVec2& pos);
     IMGUI_API bool          ArrowButtonEx(const char* str_id, ImGuiDir dir, ImVec2 size_arg, ImGuiButtonFlags flags = 0);
@@ -2895,6 +3008,8 @@ IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas,
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
+IMGUI_API bool      ImFontAtlasBuildUpdateDynamicGlyphs(ImFontAtlas* atlas);       // Grow the texture and rasterize glyphs which didn't fit in it during the last frame (ImFontAtlasFlags_DynamicGlyphs). Return true when the texture was resized.
+IMGUI_API bool      ImFontAtlasBuildHasPendingGlyphs(const ImFontAtlas* atlas);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
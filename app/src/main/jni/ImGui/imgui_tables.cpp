@@ -202,6 +202,9 @@ Index of this file:
 #else
 #include <stdint.h>     // intptr_t
 #endif
+#ifdef IMGUI_ENABLE_THREADED_TABLE_SORT
+#include <thread>       // std::thread
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -2595,6 +2598,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
 // - TableSetColumnSortDirection() [Internal]
 // - TableSortSpecsSanitize() [Internal]
 // - TableSortSpecsBuild() [Internal]
+// - ImGuiTableSortIndex
 //-------------------------------------------------------------------------
 
 // Return NULL if no sort specs (most often when ImGuiTableFlags_Sortable is not set)
@@ -2782,6 +2786,224 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+struct ImGuiTableSortContext
+{
+    const ImGuiTableColumnSortSpecs*    Specs;
+    int                                 SpecsCount;
+    ImGuiTableSortCompareFunc           CompareFunc;
+    void*                               UserData;
+
+    // Return true if row_a goes before row_b. Rows which compare equal on all specs are ordered by index, so the order is total and the sort stable.
+    bool Less(int row_a, int row_b) const
+    {
+        for (int n = 0; n < SpecsCount; n++)
+            if (int delta = CompareFunc(row_a, row_b, &Specs[n], UserData))
+                return (Specs[n].SortDirection == ImGuiSortDirection_Descending) ? (delta > 0) : (delta < 0);
+        return row_a < row_b;
+    }
+};
+
+// Merge sorted rows [a, a + a_count) and [b, b + b_count) into 'out'
+static void TableSortIndexMerge(const ImGuiTableSortContext* ctx, const int* a, int a_count, const int* b, int b_count, int* out)
+{
+    const int* a_end = a + a_count;
+    const int* b_end = b + b_count;
+    while (a < a_end && b < b_end)
+        *out++ = ctx->Less(*b, *a) ? *b++ : *a++;
+    if (a < a_end)
+        memcpy(out, a, (size_t)(a_end - a) * sizeof(int));
+    if (b < b_end)
+        memcpy(out, b, (size_t)(b_end - b) * sizeof(int));
+}
+
+// Sort 'count' rows, using 'temp' as scratch: insertion sort of small runs, then bottom-up merge passes going back and forth between the two buffers.
+static void TableSortIndexSortRange(const ImGuiTableSortContext* ctx, int* rows, int* temp, int count)
+{
+    const int RUN_SIZE = 16;
+    for (int run_begin = 0; run_begin < count; run_begin += RUN_SIZE)
+    {
+        const int run_end = ImMin(run_begin + RUN_SIZE, count);
+        for (int i = run_begin + 1; i < run_end; i++)
+        {
+            const int row = rows[i];
+            int j = i;
+            for (; j > run_begin && ctx->Less(row, rows[j - 1]); j--)
+                rows[j] = rows[j - 1];
+            rows[j] = row;
+        }
+    }
+    int* src = rows;
+    int* dst = temp;
+    for (int width = RUN_SIZE; width < count; width *= 2)
+    {
+        for (int lo = 0; lo < count; lo += width * 2)
+        {
+            const int mid = ImMin(lo + width, count);
+            const int hi = ImMin(lo + width * 2, count);
+            TableSortIndexMerge(ctx, src + lo, mid - lo, src + mid, hi - mid, dst + lo);
+        }
+        ImSwap(src, dst);
+    }
+    if (src != rows)
+        memcpy(rows, src, (size_t)count * sizeof(int));
+}
+
+#ifdef IMGUI_ENABLE_THREADED_TABLE_SORT
+static void TableSortIndexMergeJob(const ImGuiTableSortContext* ctx, const int* src, int* dst, int lo, int mid, int hi)
+{
+    TableSortIndexMerge(ctx, src + lo, mid - lo, src + mid, hi - mid, dst + lo);
+}
+#endif
+
+// Sort 'count' rows, splitting the work between up to 'threads_count' threads
+static void TableSortIndexSort(const ImGuiTableSortContext* ctx, int* rows, int* temp, int count, int threads_count)
+{
+#ifdef IMGUI_ENABLE_THREADED_TABLE_SORT
+    const int THREADS_MAX = 32;
+    const int MIN_ROWS_PER_THREAD = 16384;
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    threads_count = ImMin(ImMin(threads_count, count / MIN_ROWS_PER_THREAD), THREADS_MAX);
+    if (threads_count > 1)
+    {
+        // Sort one chunk per thread (the calling thread sorts the first one)
+        std::thread threads[THREADS_MAX];
+        int chunks[THREADS_MAX + 1];
+        for (int chunk_n = 0; chunk_n <= threads_count; chunk_n++)
+            chunks[chunk_n] = (int)((ImS64)count * chunk_n / threads_count);
+        for (int thread_n = 1; thread_n < threads_count; thread_n++)
+            threads[thread_n] = std::thread(TableSortIndexSortRange, ctx, rows + chunks[thread_n], temp + chunks[thread_n], chunks[thread_n + 1] - chunks[thread_n]);
+        TableSortIndexSortRange(ctx, rows, temp, chunks[1]);
+        for (int thread_n = 1; thread_n < threads_count; thread_n++)
+            threads[thread_n].join();
+
+        // Merge chunks two by two, merges of a same pass running in parallel
+        int* src = rows;
+        int* dst = temp;
+        for (int chunks_count = threads_count; chunks_count > 1; chunks_count = (chunks_count + 1) / 2)
+        {
+            for (int chunk_n = 2; chunk_n < chunks_count; chunk_n += 2)
+                threads[chunk_n / 2] = std::thread(TableSortIndexMergeJob, ctx, src, dst, chunks[chunk_n], chunks[ImMin(chunk_n + 1, chunks_count)], chunks[ImMin(chunk_n + 2, chunks_count)]);
+            TableSortIndexMergeJob(ctx, src, dst, chunks[0], chunks[1], chunks[ImMin(2, chunks_count)]);
+            for (int chunk_n = 2; chunk_n < chunks_count; chunk_n += 2)
+                threads[chunk_n / 2].join();
+            for (int chunk_n = 0; chunk_n < chunks_count; chunk_n += 2)
+                chunks[chunk_n / 2] = chunks[chunk_n];
+            chunks[(chunks_count + 1) / 2] = count;
+            ImSwap(src, dst);
+        }
+        if (src != rows)
+            memcpy(rows, src, (size_t)count * sizeof(int));
+        return;
+    }
+#else
+    IM_UNUSED(threads_count);
+#endif
+    TableSortIndexSortRange(ctx, rows, temp, count);
+}
+
+bool ImGuiTableSortIndex::Update(ImGuiTableSortSpecs* sort_specs, int rows_count)
+{
+    IM_ASSERT(rows_count >= 0);
+
+    // Copy sort specs when they changed
+    if (sort_specs != NULL && sort_specs->SpecsDirty)
+    {
+        Specs.resize(sort_specs->SpecsCount);
+        if (sort_specs->SpecsCount > 0)
+            memcpy(Specs.Data, sort_specs->Specs, (size_t)sort_specs->SpecsCount * sizeof(ImGuiTableColumnSortSpecs));
+        sort_specs->SpecsDirty = false;
+        NeedFullSort = true;
+    }
+    else if (sort_specs == NULL && Specs.Size > 0)
+    {
+        Specs.resize(0);
+        NeedFullSort = true;
+    }
+    IM_ASSERT((Specs.Size == 0 || CompareFunc != NULL) && "Need a compare function to sort rows!");
+
+    // Drop removed rows, mark appended rows as dirty
+    const int prev_rows_count = Rows.Size;
+    bool changed = false;
+    if (rows_count < prev_rows_count && !NeedFullSort)
+    {
+        int kept_count = 0;
+        for (int n = 0; n < Rows.Size; n++)
+            if (Rows[n] < rows_count)
+                Rows[kept_count++] = Rows[n];
+        Rows.resize(kept_count);
+        changed = true;
+    }
+    for (int row_n = prev_rows_count; row_n < rows_count; row_n++)
+        DirtyRows.push_back(row_n);
+
+    // Full sort: when specs changed or when most rows are dirty
+    ImGuiTableSortContext ctx = { Specs.Data, Specs.Size, CompareFunc, UserData };
+    if (NeedFullSort || DirtyRows.Size > rows_count / 4)
+    {
+        Rows.resize(rows_count);
+        for (int row_n = 0; row_n < rows_count; row_n++)
+            Rows[row_n] = row_n;
+        if (Specs.Size > 0)
+        {
+            TempRows.resize(rows_count);
+            TableSortIndexSort(&ctx, Rows.Data, TempRows.Data, rows_count, ThreadsCount);
+        }
+        DirtyRows.resize(0);
+        NeedFullSort = false;
+        return true;
+    }
+    if (DirtyRows.Size == 0)
+        return changed;
+
+    // Incremental update: take dirty rows out (without duplicates), sort them and merge them back
+    ImBitVector dirty_mask;
+    dirty_mask.Create(rows_count);
+    int dirty_count = 0;
+    for (int n = 0; n < DirtyRows.Size; n++)
+    {
+        const int row_n = DirtyRows[n];
+        if (row_n < 0 || row_n >= rows_count || dirty_mask.TestBit(row_n))
+            continue;
+        dirty_mask.SetBit(row_n);
+        DirtyRows[dirty_count++] = row_n;
+    }
+    int kept_count = 0;
+    for (int n = 0; n < Rows.Size; n++)
+        if (!dirty_mask.TestBit(Rows[n]))
+            Rows[kept_count++] = Rows[n];
+    IM_ASSERT(kept_count + dirty_count == rows_count);
+    TempRows.resize(rows_count);
+    TableSortIndexSortRange(&ctx, DirtyRows.Data, TempRows.Data, dirty_count);
+
+    // Binary search the position of each dirty row among kept rows (positions are increasing as dirty rows are sorted), copy kept rows in between.
+    // This calls the compare function O(K log N) times instead of O(N) for a plain merge, which matters as it generally fetches rows data from all over memory.
+    const int* kept = Rows.Data;
+    int* out = TempRows.Data;
+    int kept_n = 0;
+    for (int n = 0; n < dirty_count; n++)
+    {
+        const int dirty_row = DirtyRows[n];
+        int lo = kept_n, hi = kept_count;
+        while (lo < hi)
+        {
+            const int mid = lo + (hi - lo) / 2;
+            if (ctx.Less(kept[mid], dirty_row))
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        memcpy(out, kept + kept_n, (size_t)(lo - kept_n) * sizeof(int));
+        out += lo - kept_n;
+        *out++ = dirty_row;
+        kept_n = lo;
+    }
+    memcpy(out, kept + kept_n, (size_t)(kept_count - kept_n) * sizeof(int));
+    Rows.swap(TempRows);
+    DirtyRows.resize(0);
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -3162,18 +3384,20 @@ ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
     ImGuiContext& g = *GImGui;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
+    g.SettingsTablesById.SetInt(id, g.SettingsTables.offset_from_ptr(settings));
     return settings;
 }
 
 // Find existing settings
+// (entries invalidated by a columns count change keep their offset in the map until a new entry is created, hence the ID check)
 ImGuiTableSettings* ImGui::TableSettingsFindByID(ImGuiID id)
 {
-    // FIXME-OPT: Might want to store a lookup map for this?
     ImGuiContext& g = *GImGui;
-    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsTablesById.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(offset);
+    return (settings->ID == id) ? settings : NULL;
 }
 
 // Get settings for a given table, NULL if none
@@ -3214,6 +3438,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
         settings = TableSettingsCreate(table->ID, table->ColumnsCount);
         table->SettingsOffset = g.SettingsTables.offset_from_ptr(settings);
     }
+    settings->IniTextSize = 0; // Format again on next save
     settings->ColumnsCount = (ImGuiTableColumnIdx)table->ColumnsCount;
 
     // Serialize ImGuiTable/ImGuiTableColumn into ImGuiTableSettings/ImGuiTableColumnSettings
@@ -3327,6 +3552,7 @@ static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (ImGuiTable* table = g.Tables.TryGetMapData(i))
             table->SettingsOffset = -1;
     g.SettingsTables.clear();
+    g.SettingsTablesById.Clear();
 }
 
 // Apply to existing windows (if any)
@@ -3401,6 +3627,11 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
         const bool save_order   = (settings->SaveFlags & ImGuiTableFlags_Reorderable) != 0;
         const bool save_sort    = (settings->SaveFlags & ImGuiTableFlags_Sortable) != 0;
         if (!save_size && !save_visible && !save_order && !save_sort)
+        {
+            settings->IniTextSize = 0;
+            continue;
+        }
+        if (!ImGui::SettingsBeginWriteEntry(buf, &settings->IniTextOffset, &settings->IniTextSize))
             continue;
 
         buf->reserve(buf->size() + 30 + settings->ColumnsCount * 50); // ballpark reserve
@@ -3424,6 +3655,7 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
             buf->append("\n");
         }
         buf->append("\n");
+        ImGui::SettingsEndWriteEntry(buf, &settings->IniTextOffset, &settings->IniTextSize);
     }
 }
 
@@ -3499,6 +3731,11 @@ void ImGui::TableGcCompactSettings()
         if (settings->ID != 0)
             memcpy(new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount)), settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
     g.SettingsTables.swap(new_chunk_stream);
+
+    // Offsets changed: rebuild the lookup map
+    g.SettingsTablesById.Clear();
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        g.SettingsTablesById.SetInt(settings->ID, g.SettingsTables.offset_from_ptr(settings));
 }
 
 
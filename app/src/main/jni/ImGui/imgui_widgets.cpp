@@ -180,7 +180,65 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
 
         // Lines to skip (can't skip when logging text)
         ImVec2 pos = text_pos;
-        if (!g.LogEnabled)
+        ImGuiTextLayoutCacheEntry* entry = g.LogEnabled ? NULL : GetTextLayoutCacheEntry(text, text_end, 0.0f);
+        if (entry != NULL)
+        {
+            // Lines are kept in the text layout cache, so we can jump to the first visible line without scanning the text
+            if (!entry->HasLines)
+            {
+                entry->Lines.resize(0);
+                while (line < text_end)
+                {
+                    const char* line_end = (const char*)memchr(line, '\n', text_end - line);
+                    if (!line_end)
+                        line_end = text_end;
+                    entry->Lines.push_back((int)(line - text));
+                    entry->Lines.push_back((int)(line_end - text));
+                    line = line_end + 1;
+                }
+                entry->HasLines = true;
+                g.TextLayoutCacheMissCount++;
+            }
+            else
+            {
+                g.TextLayoutCacheHitCount++;
+            }
+            const int lines_count = entry->Lines.Size / 2;
+            if ((flags & ImGuiTextFlags_NoWidthForLargeClippedText) == 0)
+            {
+                // Measure all lines once, as CalcTextSize(line_begin, line_end) would, text after "##" included (not calling it, as it would look up the same cache)
+                if (entry->LinesWidth < 0.0f)
+                {
+                    entry->LinesWidth = 0.0f;
+                    for (int line_n = 0; line_n < lines_count; line_n++)
+                    {
+                        const char* line_begin = text + entry->Lines[line_n * 2];
+                        const char* line_end = text + entry->Lines[line_n * 2 + 1];
+                        if (line_begin != line_end)
+                            entry->LinesWidth = ImMax(entry->LinesWidth, IM_FLOOR(g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, -1.0f, line_begin, line_end).x + 0.99999f));
+                    }
+                }
+                text_size.x = entry->LinesWidth;
+            }
+
+            int line_n = ImClamp((int)((window->ClipRect.Min.y - text_pos.y) / line_height), 0, lines_count);
+            pos.y += line_n * line_height;
+            ImRect line_rect(pos, pos + ImVec2(FLT_MAX, line_height));
+            for (; line_n < lines_count; line_n++)
+            {
+                if (IsClippedEx(line_rect, 0))
+                    break;
+                const char* line_begin = text + entry->Lines[line_n * 2];
+                const char* line_end = text + entry->Lines[line_n * 2 + 1];
+                text_size.x = ImMax(text_size.x, CalcTextSize(line_begin, line_end).x);
+                RenderText(pos, line_begin, line_end, false);
+                line_rect.Min.y += line_height;
+                line_rect.Max.y += line_height;
+                pos.y += line_height;
+            }
+            pos.y += (lines_count - line_n) * line_height;
+        }
+        else if (!g.LogEnabled)
         {
             int lines_skippable = (int)((window->ClipRect.Min.y - text_pos.y) / line_height);
             if (lines_skippable > 0)
@@ -201,7 +259,7 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
         }
 
         // Lines to render
-        if (line < text_end)
+        if (entry == NULL && line < text_end)
         {
             ImRect line_rect(pos, pos + ImVec2(FLT_MAX, line_height));
             while (line < text_end)
@@ -260,6 +318,11 @@ void ImGui::TextUnformatted(const char* text, const char* text_end)
     TextEx(text, text_end, ImGuiTextFlags_NoWidthForLargeClippedText);
 }
 
+void ImGui::TextUnformatted(ImStrv text)
+{
+    TextEx(text.Begin, text.End, ImGuiTextFlags_NoWidthForLargeClippedText);
+}
+
 void ImGui::Text(const char* fmt, ...)
 {
     va_list args;
@@ -668,7 +731,7 @@ bool ImGui::ButtonBehavior(const ImRect& bb, ImGuiID id, bool* out_hovered, bool
     return pressed;
 }
 
-bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags)
+bool ImGui::ButtonEx(ImStrv label, const ImVec2& size_arg, ImGuiButtonFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -677,7 +740,8 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const char* label_end = FindRenderedTextEnd(label.Begin, label.End);
+    const ImVec2 label_size = CalcTextSize(label.Begin, label_end, false);
 
     ImVec2 pos = window->DC.CursorPos;
     if ((flags & ImGuiButtonFlags_AlignTextBaseLine) && style.FramePadding.y < window->DC.CurrLineTextBaseOffset) // Try to vertically align buttons that are smaller/have no padding so that text baseline matches (bit hacky, since it shouldn't be a flag)
@@ -702,13 +766,13 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
 
     if (g.LogEnabled)
         LogSetNextTextDecoration("[", "]");
-    RenderTextClipped(bb.Min + style.FramePadding, bb.Max - style.FramePadding, label, NULL, &label_size, style.ButtonTextAlign, &bb);
+    RenderTextClipped(bb.Min + style.FramePadding, bb.Max - style.FramePadding, label.Begin, label_end, &label_size, style.ButtonTextAlign, &bb, false);
 
     // Automatically close popups
     //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
     //    CloseCurrentPopup();
 
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label.Begin, g.LastItemData.StatusFlags);
     return pressed;
 }
 
@@ -717,8 +781,18 @@ bool ImGui::Button(const char* label, const ImVec2& size_arg)
     return ButtonEx(label, size_arg, ImGuiButtonFlags_None);
 }
 
+bool ImGui::Button(ImStrv label, const ImVec2& size_arg)
+{
+    return ButtonEx(label, size_arg, ImGuiButtonFlags_None);
+}
+
 // Small buttons fits within text without additional vertical spacing.
 bool ImGui::SmallButton(const char* label)
+{
+    return SmallButton(ImStrv(label));
+}
+
+bool ImGui::SmallButton(ImStrv label)
 {
     ImGuiContext& g = *GImGui;
     float backup_padding_y = g.Style.FramePadding.y;
@@ -1074,6 +1148,11 @@ bool ImGui::ImageButton(ImTextureID user_texture_id, const ImVec2& size, const I
 }
 
 bool ImGui::Checkbox(const char* label, bool* v)
+{
+    return Checkbox(ImStrv(label), v);
+}
+
+bool ImGui::Checkbox(ImStrv label, bool* v)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -1082,7 +1161,8 @@ bool ImGui::Checkbox(const char* label, bool* v)
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const char* label_end = FindRenderedTextEnd(label.Begin, label.End);
+    const ImVec2 label_size = CalcTextSize(label.Begin, label_end, false);
 
     const float square_sz = GetFrameHeight();
     const ImVec2 pos = window->DC.CursorPos;
@@ -1090,7 +1170,7 @@ bool ImGui::Checkbox(const char* label, bool* v)
     ItemSize(total_bb, style.FramePadding.y);
     if (!ItemAdd(total_bb, id))
     {
-        IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (*v ? ImGuiItemStatusFlags_Checked : 0));
+        IMGUI_TEST_ENGINE_ITEM_INFO(id, label.Begin, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (*v ? ImGuiItemStatusFlags_Checked : 0));
         return false;
     }
 
@@ -1124,9 +1204,9 @@ bool ImGui::Checkbox(const char* label, bool* v)
     if (g.LogEnabled)
         LogRenderedText(&label_pos, mixed_value ? "[~]" : *v ? "[x]" : "[ ]");
     if (label_size.x > 0.0f)
-        RenderText(label_pos, label);
+        RenderText(label_pos, label.Begin, label_end, false);
 
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (*v ? ImGuiItemStatusFlags_Checked : 0));
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label.Begin, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (*v ? ImGuiItemStatusFlags_Checked : 0));
     return pressed;
 }
 
@@ -1180,6 +1260,11 @@ bool ImGui::CheckboxFlags(const char* label, ImU64* flags, ImU64 flags_value)
 }
 
 bool ImGui::RadioButton(const char* label, bool active)
+{
+    return RadioButton(ImStrv(label), active);
+}
+
+bool ImGui::RadioButton(ImStrv label, bool active)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -1188,7 +1273,8 @@ bool ImGui::RadioButton(const char* label, bool active)
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const char* label_end = FindRenderedTextEnd(label.Begin, label.End);
+    const ImVec2 label_size = CalcTextSize(label.Begin, label_end, false);
 
     const float square_sz = GetFrameHeight();
     const ImVec2 pos = window->DC.CursorPos;
@@ -1226,9 +1312,9 @@ bool ImGui::RadioButton(const char* label, bool active)
     if (g.LogEnabled)
         LogRenderedText(&label_pos, active ? "(x)" : "( )");
     if (label_size.x > 0.0f)
-        RenderText(label_pos, label);
+        RenderText(label_pos, label.Begin, label_end, false);
 
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label.Begin, g.LastItemData.StatusFlags);
     return pressed;
 }
 
@@ -3648,20 +3734,69 @@ static int  STB_TEXTEDIT_MOVEWORDRIGHT_WIN(ImGuiInputTextState* obj, int idx)
 #define STB_TEXTEDIT_MOVEWORDRIGHT  STB_TEXTEDIT_MOVEWORDRIGHT_WIN
 #endif
 
+// Rows are lines as we don't word-wrap, so the line index lets stb_textedit.h start laying out rows next to the one it is looking for.
+// Positions are computed as multiples of the line height, which only matches the laid out rows when the line height is integer.
+static int  STB_TEXTEDIT_SKIPROWS_TO_CHAR_IMPL(ImGuiInputTextState* obj, int idx, float* out_y)
+{
+    ImGuiContext& g = *GImGui;
+    if (obj->LineOffsetsW.Size == 0 || g.FontSize != IM_FLOOR(g.FontSize))
+        return 0;
+    const int line_n = ImMax(obj->FindLineIndex(idx) - 1, 0); // Row before, as the caller also wants the previous row
+    *out_y = line_n * g.FontSize;
+    return obj->LineOffsetsW[line_n];
+}
+static int  STB_TEXTEDIT_SKIPROWS_TO_Y_IMPL(ImGuiInputTextState* obj, float y, float* out_y)
+{
+    ImGuiContext& g = *GImGui;
+    if (obj->LineOffsetsW.Size == 0 || g.FontSize != IM_FLOOR(g.FontSize) || y < g.FontSize)
+        return 0;
+    const int line_n = (int)ImMin(y / g.FontSize - 1.0f, (float)(obj->LineOffsetsW.Size - 1));
+    *out_y = line_n * g.FontSize;
+    return obj->LineOffsetsW[line_n];
+}
+#define STB_TEXTEDIT_SKIPROWS_TO_CHAR   STB_TEXTEDIT_SKIPROWS_TO_CHAR_IMPL
+#define STB_TEXTEDIT_SKIPROWS_TO_Y      STB_TEXTEDIT_SKIPROWS_TO_Y_IMPL
+
+// Edits are applied to both TextW and TextA (once valid), so the cost is a memmove of the tail and no full UTF-8 conversion
 static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
+    // Undo records may point past the end when a callback modified the text (those edits are not recorded in the undo stack)
+    n = ImMin(n, obj->CurLenW - pos);
+    if (n <= 0)
+        return;
+
     ImWchar* dst = obj->TextW.Data + pos;
+    const int pos_a = obj->CalcUtf8Offset(pos);
+    const int n_a = ImTextCountUtf8BytesFromStr(dst, dst + n);
+
+    // Offset remaining text, including zero-terminator
+    memmove(dst, dst + n, (size_t)(obj->CurLenW - pos - n + 1) * sizeof(ImWchar));
+    if (obj->TextAIsValid)
+        memmove(obj->TextA.Data + pos_a, obj->TextA.Data + pos_a + n_a, (size_t)(obj->CurLenA - pos_a - n_a + 1));
+
+    // Remove the lines starting within the deleted characters and offset the following ones
+    if (obj->LineOffsetsW.Size > 0)
+    {
+        const int line_begin = obj->FindLineIndex(pos) + 1;
+        const int line_end = obj->FindLineIndex(pos + n) + 1;
+        if (line_end > line_begin)
+        {
+            obj->LineOffsetsW.erase(obj->LineOffsetsW.Data + line_begin, obj->LineOffsetsW.Data + line_end);
+            obj->LineOffsetsA.erase(obj->LineOffsetsA.Data + line_begin, obj->LineOffsetsA.Data + line_end);
+        }
+        for (int line_n = line_begin; line_n < obj->LineOffsetsW.Size; line_n++)
+        {
+            obj->LineOffsetsW[line_n] -= n;
+            obj->LineOffsetsA[line_n] -= n_a;
+        }
+    }
 
     // We maintain our buffer length in both UTF-8 and wchar formats
     obj->Edited = true;
-    obj->CurLenA -= ImTextCountUtf8BytesFromStr(dst, dst + n);
+    obj->CurLenA -= n_a;
     obj->CurLenW -= n;
-
-    // Offset remaining text (FIXME-OPT: Use memmove)
-    const ImWchar* src = obj->TextW.Data + pos + n;
-    while (ImWchar c = *src++)
-        *dst++ = c;
-    *dst = '\0';
+    obj->LastPosW = pos;
+    obj->LastPosA = pos_a;
 }
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ImWchar* new_text, int new_text_len)
@@ -3683,15 +3818,58 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const Im
         obj->TextW.resize(text_len + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1);
     }
 
+    const int pos_a = obj->CalcUtf8Offset(pos);
     ImWchar* text = obj->TextW.Data;
     if (pos != text_len)
         memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos) * sizeof(ImWchar));
     memcpy(text + pos, new_text, (size_t)new_text_len * sizeof(ImWchar));
 
+    if (obj->TextAIsValid)
+    {
+        if (obj->CurLenA + new_text_len_utf8 + 1 > obj->TextA.Size)
+            obj->TextA.resize(obj->CurLenA + ImClamp(new_text_len_utf8 * 4, 32, ImMax(256, new_text_len_utf8)) + 1);
+        char* text_a = obj->TextA.Data + pos_a;
+        memmove(text_a + new_text_len_utf8, text_a, (size_t)(obj->CurLenA - pos_a + 1));
+        const char backup_c = text_a[new_text_len_utf8]; // ImTextStrToUtf8() writes a zero-terminator over the first character of the tail
+        ImTextStrToUtf8(text_a, new_text_len_utf8 + 1, new_text, new_text + new_text_len);
+        text_a[new_text_len_utf8] = backup_c;
+    }
+
+    // Offset the lines following the insertion point and add the lines started by the new text
+    if (obj->LineOffsetsW.Size > 0)
+    {
+        const int line_begin = obj->FindLineIndex(pos) + 1;
+        int new_lines_count = 0;
+        for (int i = 0; i < new_text_len; i++)
+            new_lines_count += (new_text[i] == '\n') ? 1 : 0;
+        const int old_lines_count = obj->LineOffsetsW.Size;
+        obj->LineOffsetsW.resize(old_lines_count + new_lines_count);
+        obj->LineOffsetsA.resize(old_lines_count + new_lines_count);
+        for (int line_n = old_lines_count - 1; line_n >= line_begin; line_n--)
+        {
+            obj->LineOffsetsW[line_n + new_lines_count] = obj->LineOffsetsW[line_n] + new_text_len;
+            obj->LineOffsetsA[line_n + new_lines_count] = obj->LineOffsetsA[line_n] + new_text_len_utf8;
+        }
+        int line_n = line_begin;
+        const ImWchar* new_line_begin = new_text;
+        int new_line_begin_a = pos_a;
+        for (const ImWchar* p = new_text; line_n < line_begin + new_lines_count; p++)
+            if (*p == '\n')
+            {
+                new_line_begin_a += ImTextCountUtf8BytesFromStr(new_line_begin, p + 1);
+                new_line_begin = p + 1;
+                obj->LineOffsetsW[line_n] = pos + (int)(new_line_begin - new_text);
+                obj->LineOffsetsA[line_n] = new_line_begin_a;
+                line_n++;
+            }
+    }
+
     obj->Edited = true;
     obj->CurLenW += new_text_len;
     obj->CurLenA += new_text_len_utf8;
     obj->TextW[obj->CurLenW] = '\0';
+    obj->LastPosW = pos + new_text_len;
+    obj->LastPosA = pos_a + new_text_len_utf8;
 
     return true;
 }
@@ -3744,6 +3922,65 @@ void ImGuiInputTextState::OnKeyPressed(int key)
     CursorAnimReset();
 }
 
+int ImGuiInputTextState::CalcUtf8Offset(int pos_w)
+{
+    pos_w = ImClamp(pos_w, 0, CurLenW); // Selection may briefly point past the end after a callback shortened the text
+    if (LastPosW > CurLenW)
+        LastPosW = LastPosA = 0;
+    const ImWchar* text = TextW.Data;
+    int pos_a;
+    if (pos_w >= LastPosW)
+    {
+        if (pos_w - LastPosW <= CurLenW - pos_w)
+            pos_a = LastPosA + ImTextCountUtf8BytesFromStr(text + LastPosW, text + pos_w);
+        else
+            pos_a = CurLenA - ImTextCountUtf8BytesFromStr(text + pos_w, text + CurLenW);
+    }
+    else
+    {
+        if (LastPosW - pos_w <= pos_w)
+            pos_a = LastPosA - ImTextCountUtf8BytesFromStr(text + pos_w, text + LastPosW);
+        else
+            pos_a = ImTextCountUtf8BytesFromStr(text, text + pos_w);
+    }
+    LastPosW = pos_w;
+    LastPosA = pos_a;
+    return pos_a;
+}
+
+void ImGuiInputTextState::BuildLineOffsets()
+{
+    LineOffsetsW.resize(0);
+    LineOffsetsA.resize(0);
+    LineOffsetsW.push_back(0);
+    LineOffsetsA.push_back(0);
+    const ImWchar* text = TextW.Data;
+    const ImWchar* line_begin = text;
+    int line_begin_a = 0;
+    for (const ImWchar* s = text; s < text + CurLenW; s++)
+        if (*s == '\n')
+        {
+            line_begin_a += ImTextCountUtf8BytesFromStr(line_begin, s + 1);
+            line_begin = s + 1;
+            LineOffsetsW.push_back((int)(line_begin - text));
+            LineOffsetsA.push_back(line_begin_a);
+        }
+}
+
+int ImGuiInputTextState::FindLineIndex(int pos_w) const
+{
+    IM_ASSERT(LineOffsetsW.Size > 0);
+    int first = 0, count = LineOffsetsW.Size;
+    while (count > 1)
+    {
+        const int half = count >> 1;
+        if (LineOffsetsW[first + half] <= pos_w)
+            first += half;
+        count -= half;
+    }
+    return first;
+}
+
 ImGuiInputTextCallbackData::ImGuiInputTextCallbackData()
 {
     memset(this, 0, sizeof(*this));
@@ -4018,6 +4255,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
         state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        state->OnTextRewritten();
 
         // Preserve cursor position and undo/redo stack if we come back to same widget
         // FIXME: For non-readonly widgets we might be able to require that TextAIsValid && TextA == buf ? (untested) and discard undo stack if user buffer has changed.
@@ -4097,6 +4335,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->TextW.resize(buf_size + 1);
         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, buf, NULL, &buf_end);
         state->CurLenA = (int)(buf_end - buf);
+        state->TextAIsValid = false;
+        state->OnTextRewritten();
         state->CursorClamp();
         render_selection &= state->HasSelection();
     }
@@ -4399,12 +4639,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             // Apply new value immediately - copy modified buffer back
             // Note that as soon as the input box is active, the in-widget value gets priority over any underlying modification of the input buffer
             // FIXME: We actually always render 'buf' when calling DrawList->AddText, making the comment above incorrect.
-            // FIXME-OPT: CPU waste to do this every time the widget is active, should mark dirty state from the stb_textedit callbacks.
-            if (!is_readonly)
+            // Once valid, TextA is kept in sync by STB_TEXTEDIT_INSERTCHARS/DELETECHARS so we only convert the whole text once.
+            if (!is_readonly && !state->TextAIsValid)
             {
                 state->TextAIsValid = true;
                 state->TextA.resize(state->TextW.Size * 4 + 1);
-                ImTextStrToUtf8(state->TextA.Data, state->TextA.Size, state->TextW.Data, NULL);
+                ImTextStrToUtf8(state->TextA.Data, state->TextA.Size, state->TextW.Data, state->TextW.Data + state->CurLenW);
             }
 
             // User callback
@@ -4455,10 +4695,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     callback_data.BufDirty = false;
 
                     // We have to convert from wchar-positions to UTF-8-positions, which can be pretty slow (an incentive to ditch the ImWchar buffer, see https://github.com/nothings/stb/issues/188)
-                    ImWchar* text = state->TextW.Data;
-                    const int utf8_cursor_pos = callback_data.CursorPos = ImTextCountUtf8BytesFromStr(text, text + state->Stb.cursor);
-                    const int utf8_selection_start = callback_data.SelectionStart = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_start);
-                    const int utf8_selection_end = callback_data.SelectionEnd = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_end);
+                    const int utf8_selection_start = callback_data.SelectionStart = state->CalcUtf8Offset(state->Stb.select_start);
+                    const int utf8_selection_end = callback_data.SelectionEnd = state->CalcUtf8Offset(state->Stb.select_end);
+                    const int utf8_cursor_pos = callback_data.CursorPos = state->CalcUtf8Offset(state->Stb.cursor);
 
                     // Call user code
                     callback(&callback_data);
@@ -4479,6 +4718,13 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                             state->TextW.resize(state->TextW.Size + (callback_data.BufTextLen - backup_current_text_length));
                         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, callback_data.Buf, NULL);
                         state->CurLenA = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        state->OnTextRewritten();
+                        if (!is_readonly)
+                        {
+                            // Convert back so TextA matches TextW exactly (edits are applied to both from now on)
+                            state->TextA.resize(state->TextW.Size * 4 + 1);
+                            state->CurLenA = ImTextStrToUtf8(state->TextA.Data, state->TextA.Size, state->TextW.Data, state->TextW.Data + state->CurLenW);
+                        }
                         state->CursorAnimReset();
                     }
                 }
@@ -4570,6 +4816,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         const ImWchar* text_begin = state->TextW.Data;
         ImVec2 cursor_offset, select_start_offset;
 
+        // Editable multi-line text uses the line index maintained by STB_TEXTEDIT_INSERTCHARS/DELETECHARS, so we don't scan the whole text every frame.
+        // (read-only text is reloaded from the user buffer every frame, so we would have to rebuild the index every frame)
+        const bool use_line_offsets = is_multiline && !is_readonly;
+        if (use_line_offsets && state->LineOffsetsW.Size == 0)
+            state->BuildLineOffsets();
+
         {
             // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
             const ImWchar* searches_input_ptr[2] = { NULL, NULL };
@@ -4588,30 +4840,48 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 searches_remaining++;
             }
 
-            // Iterate all lines to find our line numbers
-            // In multi-line mode, we never exit the loop until all lines are counted, so add one extra to the searches_remaining counter.
-            searches_remaining += is_multiline ? 1 : 0;
             int line_count = 0;
-            //for (const ImWchar* s = text_begin; (s = (const ImWchar*)wcschr((const wchar_t*)s, (wchar_t)'\n')) != NULL; s++)  // FIXME-OPT: Could use this when wchar_t are 16-bit
-            for (const ImWchar* s = text_begin; *s != 0; s++)
-                if (*s == '\n')
-                {
-                    line_count++;
-                    if (searches_result_line_no[0] == -1 && s >= searches_input_ptr[0]) { searches_result_line_no[0] = line_count; if (--searches_remaining <= 0) break; }
-                    if (searches_result_line_no[1] == -1 && s >= searches_input_ptr[1]) { searches_result_line_no[1] = line_count; if (--searches_remaining <= 0) break; }
-                }
-            line_count++;
-            if (searches_result_line_no[0] == -1)
-                searches_result_line_no[0] = line_count;
-            if (searches_result_line_no[1] == -1)
-                searches_result_line_no[1] = line_count;
+            const ImWchar* searches_line_begin[2] = { NULL, NULL };
+            if (use_line_offsets)
+            {
+                // Binary search our line numbers in the line index
+                line_count = state->LineOffsetsW.Size;
+                for (int n = 0; n < 2; n++)
+                    if (searches_input_ptr[n] != NULL)
+                    {
+                        const int line_n = state->FindLineIndex((int)(searches_input_ptr[n] - text_begin));
+                        searches_result_line_no[n] = line_n + 1;
+                        searches_line_begin[n] = text_begin + state->LineOffsetsW[line_n];
+                    }
+            }
+            else
+            {
+                // Iterate all lines to find our line numbers
+                // In multi-line mode, we never exit the loop until all lines are counted, so add one extra to the searches_remaining counter.
+                searches_remaining += is_multiline ? 1 : 0;
+                //for (const ImWchar* s = text_begin; (s = (const ImWchar*)wcschr((const wchar_t*)s, (wchar_t)'\n')) != NULL; s++)  // FIXME-OPT: Could use this when wchar_t are 16-bit
+                for (const ImWchar* s = text_begin; *s != 0; s++)
+                    if (*s == '\n')
+                    {
+                        line_count++;
+                        if (searches_result_line_no[0] == -1 && s >= searches_input_ptr[0]) { searches_result_line_no[0] = line_count; if (--searches_remaining <= 0) break; }
+                        if (searches_result_line_no[1] == -1 && s >= searches_input_ptr[1]) { searches_result_line_no[1] = line_count; if (--searches_remaining <= 0) break; }
+                    }
+                line_count++;
+                if (searches_result_line_no[0] == -1)
+                    searches_result_line_no[0] = line_count;
+                if (searches_result_line_no[1] == -1)
+                    searches_result_line_no[1] = line_count;
+                searches_line_begin[0] = ImStrbolW(searches_input_ptr[0], text_begin);
+                searches_line_begin[1] = ImStrbolW(searches_input_ptr[1], text_begin);
+            }
 
             // Calculate 2d position by finding the beginning of the line and measuring distance
-            cursor_offset.x = InputTextCalcTextSizeW(ImStrbolW(searches_input_ptr[0], text_begin), searches_input_ptr[0]).x;
+            cursor_offset.x = InputTextCalcTextSizeW(searches_line_begin[0], searches_input_ptr[0]).x;
             cursor_offset.y = searches_result_line_no[0] * g.FontSize;
             if (searches_result_line_no[1] >= 0)
             {
-                select_start_offset.x = InputTextCalcTextSizeW(ImStrbolW(searches_input_ptr[1], text_begin), searches_input_ptr[1]).x;
+                select_start_offset.x = InputTextCalcTextSizeW(searches_line_begin[1], searches_input_ptr[1]).x;
                 select_start_offset.y = searches_result_line_no[1] * g.FontSize;
             }
 
@@ -4666,7 +4936,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             ImVec2 rect_pos = draw_pos + select_start_offset - draw_scroll;
-            for (const ImWchar* p = text_selected_begin; p < text_selected_end; )
+            const ImWchar* p = text_selected_begin;
+            if (use_line_offsets && rect_pos.y + g.FontSize < clip_rect.y && g.FontSize == IM_FLOOR(g.FontSize))
+            {
+                // Jump to the line before the first visible one (with an integer line height, this is the same position as adding it line by line)
+                const int lines_skipped = (int)((clip_rect.y - rect_pos.y) / g.FontSize) - 1;
+                const int select_start_line_n = state->FindLineIndex((int)(text_selected_begin - text_begin));
+                const int line_n = ImMin(select_start_line_n + lines_skipped, state->LineOffsetsW.Size - 1);
+                p = ImMin(text_begin + state->LineOffsetsW[line_n], text_selected_end);
+                rect_pos.x = draw_pos.x - draw_scroll.x;
+                rect_pos.y += (line_n - select_start_line_n) * g.FontSize;
+            }
+            while (p < text_selected_end)
             {
                 if (rect_pos.y > clip_rect.w + g.FontSize)
                     break;
@@ -4696,7 +4977,19 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
-            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
+            ImVec2 text_pos = draw_pos - draw_scroll;
+            const char* buf_display_begin = buf_display;
+            const float line_height = g.Font->FontSize * (g.FontSize / g.Font->FontSize); // Same as ImFont::RenderText()
+            if (use_line_offsets && buf_display_from_state && !is_displaying_hint && line_height == IM_FLOOR(line_height))
+            {
+                // Start from the line before the first visible one, at the position ImFont::RenderText() would have skipped to (it is pixel aligned)
+                const float clip_min_y = draw_window->DrawList->_CmdHeader.ClipRect.y;
+                text_pos.y = IM_FLOOR(text_pos.y);
+                const int line_n = ImClamp((int)((clip_min_y - text_pos.y) / line_height) - 1, 0, state->LineOffsetsA.Size - 1);
+                buf_display_begin += state->LineOffsetsA[line_n];
+                text_pos.y += line_n * line_height;
+            }
+            draw_window->DrawList->AddText(g.Font, g.FontSize, text_pos, col, buf_display_begin, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
         }
 
         // Draw blinking cursor
@@ -5714,11 +6007,16 @@ bool ImGui::TreeNode(const void* ptr_id, const char* fmt, ...)
 }
 
 bool ImGui::TreeNode(const char* label)
+{
+    return TreeNode(ImStrv(label));
+}
+
+bool ImGui::TreeNode(ImStrv label)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
-    return TreeNodeBehavior(window->GetID(label), 0, label, NULL);
+    return TreeNodeBehavior(window->GetID(label), 0, label.Begin, FindRenderedTextEnd(label.Begin, label.End));
 }
 
 bool ImGui::TreeNodeV(const char* str_id, const char* fmt, va_list args)
@@ -5987,7 +6285,7 @@ bool ImGui::TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* l
 
         if (g.LogEnabled)
             LogSetNextTextDecoration("###", "###");
-        RenderTextClipped(text_pos, frame_bb.Max, label, label_end, &label_size);
+        RenderTextClipped(text_pos, frame_bb.Max, label, label_end, &label_size, ImVec2(0, 0), NULL, false);
     }
     else
     {
@@ -6081,12 +6379,17 @@ void ImGui::SetNextItemOpen(bool is_open, ImGuiCond cond)
 // CollapsingHeader returns true when opened but do not indent nor push into the ID stack (because of the ImGuiTreeNodeFlags_NoTreePushOnOpen flag).
 // This is basically the same as calling TreeNodeEx(label, ImGuiTreeNodeFlags_CollapsingHeader). You can remove the _NoTreePushOnOpen flag if you want behavior closer to normal TreeNode().
 bool ImGui::CollapsingHeader(const char* label, ImGuiTreeNodeFlags flags)
+{
+    return CollapsingHeader(ImStrv(label), flags);
+}
+
+bool ImGui::CollapsingHeader(ImStrv label, ImGuiTreeNodeFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
 
-    return TreeNodeBehavior(window->GetID(label), flags | ImGuiTreeNodeFlags_CollapsingHeader, label);
+    return TreeNodeBehavior(window->GetID(label), flags | ImGuiTreeNodeFlags_CollapsingHeader, label.Begin, FindRenderedTextEnd(label.Begin, label.End));
 }
 
 // p_visible == NULL                        : regular collapsing header
@@ -6094,6 +6397,11 @@ bool ImGui::CollapsingHeader(const char* label, ImGuiTreeNodeFlags flags)
 // p_visible != NULL && *p_visible == false : do not show the header at all
 // Do not mistake this with the Open state of the header itself, which you can adjust with SetNextItemOpen() or ImGuiTreeNodeFlags_DefaultOpen.
 bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFlags flags)
+{
+    return CollapsingHeader(ImStrv(label), p_visible, flags);
+}
+
+bool ImGui::CollapsingHeader(ImStrv label, bool* p_visible, ImGuiTreeNodeFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -6106,7 +6414,7 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
     flags |= ImGuiTreeNodeFlags_CollapsingHeader;
     if (p_visible)
         flags |= ImGuiTreeNodeFlags_AllowItemOverlap | ImGuiTreeNodeFlags_ClipLabelForTrailingButton;
-    bool is_open = TreeNodeBehavior(id, flags, label);
+    bool is_open = TreeNodeBehavior(id, flags, label.Begin, FindRenderedTextEnd(label.Begin, label.End));
     if (p_visible != NULL)
     {
         // Create a small overlapping close button
@@ -6137,6 +6445,11 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
 // With this scheme, ImGuiSelectableFlags_SpanAllColumns and ImGuiSelectableFlags_AllowItemOverlap are also frequently used flags.
 // FIXME: Selectable() with (size.x == 0.0f) and (SelectableTextAlign.x > 0.0f) followed by SameLine() is currently not supported.
 bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
+{
+    return Selectable(ImStrv(label), selected, flags, size_arg);
+}
+
+bool ImGui::Selectable(ImStrv label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -6147,7 +6460,8 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
 
     // Submit label or explicit size to ItemSize(), whereas ItemAdd() will submit a larger/spanning rectangle.
     ImGuiID id = window->GetID(label);
-    ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const char* label_end = FindRenderedTextEnd(label.Begin, label.End);
+    ImVec2 label_size = CalcTextSize(label.Begin, label_end, false);
     ImVec2 size(size_arg.x != 0.0f ? size_arg.x : label_size.x, size_arg.y != 0.0f ? size_arg.y : label_size.y);
     ImVec2 pos = window->DC.CursorPos;
     pos.y += window->DC.CurrLineTextBaseOffset;
@@ -6268,7 +6582,7 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
     else if (span_all_columns && g.CurrentTable)
         TablePopBackgroundChannel();
 
-    RenderTextClipped(text_min, text_max, label, NULL, &label_size, style.SelectableTextAlign, &bb);
+    RenderTextClipped(text_min, text_max, label.Begin, label_end, &label_size, style.SelectableTextAlign, &bb, false);
 
     // Automatically close popups
     if (pressed && (window->Flags & ImGuiWindowFlags_Popup) && !(flags & ImGuiSelectableFlags_DontClosePopups) && !(g.LastItemData.InFlags & ImGuiItemFlags_SelectableDontClosePopup))
@@ -6277,11 +6591,16 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
     if (disabled_item && !disabled_global)
         EndDisabled();
 
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label.Begin, g.LastItemData.StatusFlags);
     return pressed; //-V1020
 }
 
 bool ImGui::Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
+{
+    return Selectable(ImStrv(label), p_selected, flags, size_arg);
+}
+
+bool ImGui::Selectable(ImStrv label, bool* p_selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
 {
     if (Selectable(label, *p_selected, flags, size_arg))
     {
@@ -7040,7 +7359,7 @@ void ImGui::EndMenu()
     EndPopup();
 }
 
-bool ImGui::MenuItemEx(const char* label, const char* icon, const char* shortcut, bool selected, bool enabled)
+bool ImGui::MenuItemEx(ImStrv label, const char* icon, ImStrv shortcut, bool selected, bool enabled)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -7049,7 +7368,8 @@ bool ImGui::MenuItemEx(const char* label, const char* icon, const char* shortcut
     ImGuiContext& g = *GImGui;
     ImGuiStyle& style = g.Style;
     ImVec2 pos = window->DC.CursorPos;
-    ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const char* label_end = FindRenderedTextEnd(label.Begin, label.End);
+    ImVec2 label_size = CalcTextSize(label.Begin, label_end, false);
 
     const bool menuset_is_open = IsRootOfOpenMenuSet();
     ImGuiWindow* backed_nav_window = g.NavWindow;
@@ -7075,7 +7395,7 @@ bool ImGui::MenuItemEx(const char* label, const char* icon, const char* shortcut
         PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(style.ItemSpacing.x * 2.0f, style.ItemSpacing.y));
         pressed = Selectable("", selected, selectable_flags, ImVec2(w, 0.0f));
         PopStyleVar();
-        RenderText(text_pos, label);
+        RenderText(text_pos, label.Begin, label_end, false);
         window->DC.CursorPos.x += IM_FLOOR(style.ItemSpacing.x * (-1.0f + 0.5f)); // -1 spacing to compensate the spacing added when Selectable() did a SameLine(). It would also work to call SameLine() ourselves after the PopStyleVar().
     }
     else
@@ -7084,24 +7404,24 @@ bool ImGui::MenuItemEx(const char* label, const char* icon, const char* shortcut
         // (In a typical menu window where all items are BeginMenu() or MenuItem() calls, extra_w will always be 0.0f.
         //  Only when they are other items sticking out we're going to add spacing, yet only register minimum width into the layout system.
         float icon_w = (icon && icon[0]) ? CalcTextSize(icon, NULL).x : 0.0f;
-        float shortcut_w = (shortcut && shortcut[0]) ? CalcTextSize(shortcut, NULL).x : 0.0f;
+        float shortcut_w = !shortcut.empty() ? CalcTextSize(shortcut.Begin, shortcut.End).x : 0.0f;
         float checkmark_w = IM_FLOOR(g.FontSize * 1.20f);
         float min_w = window->DC.MenuColumns.DeclColumns(icon_w, label_size.x, shortcut_w, checkmark_w); // Feedback for next frame
         float stretch_w = ImMax(0.0f, GetContentRegionAvail().x - min_w);
         pressed = Selectable("", false, selectable_flags | ImGuiSelectableFlags_SpanAvailWidth, ImVec2(min_w, 0.0f));
-        RenderText(pos + ImVec2(offsets->OffsetLabel, 0.0f), label);
+        RenderText(pos + ImVec2(offsets->OffsetLabel, 0.0f), label.Begin, label_end, false);
         if (icon_w > 0.0f)
             RenderText(pos + ImVec2(offsets->OffsetIcon, 0.0f), icon);
         if (shortcut_w > 0.0f)
         {
             PushStyleColor(ImGuiCol_Text, style.Colors[ImGuiCol_TextDisabled]);
-            RenderText(pos + ImVec2(offsets->OffsetShortcut + stretch_w, 0.0f), shortcut, NULL, false);
+            RenderText(pos + ImVec2(offsets->OffsetShortcut + stretch_w, 0.0f), shortcut.Begin, shortcut.End, false);
             PopStyleColor();
         }
         if (selected)
             RenderCheckMark(window->DrawList, pos + ImVec2(offsets->OffsetMark + stretch_w + g.FontSize * 0.40f, g.FontSize * 0.134f * 0.5f), GetColorU32(ImGuiCol_Text), g.FontSize  * 0.866f);
     }
-    IMGUI_TEST_ENGINE_ITEM_INFO(g.LastItemData.ID, label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (selected ? ImGuiItemStatusFlags_Checked : 0));
+    IMGUI_TEST_ENGINE_ITEM_INFO(g.LastItemData.ID, label.Begin, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (selected ? ImGuiItemStatusFlags_Checked : 0));
     if (!enabled)
         EndDisabled();
     PopID();
@@ -7116,7 +7436,17 @@ bool ImGui::MenuItem(const char* label, const char* shortcut, bool selected, boo
     return MenuItemEx(label, NULL, shortcut, selected, enabled);
 }
 
+bool ImGui::MenuItem(ImStrv label, ImStrv shortcut, bool selected, bool enabled)
+{
+    return MenuItemEx(label, NULL, shortcut, selected, enabled);
+}
+
 bool ImGui::MenuItem(const char* label, const char* shortcut, bool* p_selected, bool enabled)
+{
+    return MenuItem(ImStrv(label), ImStrv(shortcut), p_selected, enabled);
+}
+
+bool ImGui::MenuItem(ImStrv label, ImStrv shortcut, bool* p_selected, bool enabled)
 {
     if (MenuItemEx(label, NULL, shortcut, p_selected ? *p_selected : false, enabled))
     {
@@ -2,6 +2,8 @@
 // This is a slightly modified version of stb_textedit.h 1.13.
 // Those changes would need to be pushed into nothings/stb:
 // - Fix in stb_textedit_discard_redo (see https://github.com/nothings/stb/issues/321)
+// - Optional STB_TEXTEDIT_SKIPROWS_TO_CHAR/STB_TEXTEDIT_SKIPROWS_TO_Y to avoid laying out all rows above the cursor
+// - Optional growable undo storage with STB_TEXTEDIT_UNDO_MALLOC/STB_TEXTEDIT_UNDO_FREE/STB_TEXTEDIT_UNDOMEMORY
 // Grep for [DEAR IMGUI] to find the changes.
 
 // stb_textedit.h - v1.13  - public domain - Sean Barrett
@@ -96,6 +98,19 @@
 //        [4 + 3 * sizeof(STB_TEXTEDIT_POSITIONTYPE)] * STB_TEXTEDIT_UNDOSTATE_COUNT
 //      +          sizeof(STB_TEXTEDIT_CHARTYPE)      * STB_TEXTEDIT_UNDOCHAR_COUNT
 //
+//   [DEAR IMGUI]
+//   Alternatively, define the following to allocate the undo storage on the first
+//   edit and grow it as needed, instead of discarding the oldest undo states:
+//
+//      STB_TEXTEDIT_UNDO_MALLOC(sz)      allocate sz bytes
+//      STB_TEXTEDIT_UNDO_FREE(p)         free memory allocated by STB_TEXTEDIT_UNDO_MALLOC
+//      STB_TEXTEDIT_UNDOMEMORY           max size of the undo storage in bytes, the oldest
+//                                        undo states are discarded past it
+//
+//   STB_TEXTEDIT_UNDOSTATECOUNT and STB_TEXTEDIT_UNDOCHARCOUNT are then the initial
+//   sizes. The STB_TexteditState must be zero-initialized before the first call to
+//   stb_textedit_initialize_state(), which frees the storage of the previous text.
+//
 //
 // Implementation mode:
 //
@@ -171,6 +186,10 @@
 //    STB_TEXTEDIT_K_LINEEND2            secondary keyboard input to move cursor to end of line
 //    STB_TEXTEDIT_K_TEXTSTART2          secondary keyboard input to move cursor to start of text
 //    STB_TEXTEDIT_K_TEXTEND2            secondary keyboard input to move cursor to end of text
+//    STB_TEXTEDIT_SKIPROWS_TO_CHAR(obj,i,y*)  [DEAR IMGUI] returns the first char of a row at or before the row preceding the one
+//                                               containing character #i, and writes its y to *y; return 0 to lay out from the start
+//    STB_TEXTEDIT_SKIPROWS_TO_Y(obj,y,by*)    [DEAR IMGUI] returns the first char of a row at or before the row straddling y, and
+//                                               writes its y to *by; return 0 to lay out from the start
 //
 // Keyboard input must be encoded as a single integer value; e.g. a character code
 // and some bitflags that represent shift states. to simplify the interface, SHIFT must
@@ -308,12 +327,29 @@ typedef struct
 typedef struct
 {
    // private data
+#ifdef STB_TEXTEDIT_UNDO_MALLOC
+   // [DEAR IMGUI]
+   StbUndoRecord         *undo_rec;
+   STB_TEXTEDIT_CHARTYPE *undo_char;
+   int undo_rec_count, undo_char_count;
+#else
    StbUndoRecord          undo_rec [STB_TEXTEDIT_UNDOSTATECOUNT];
    STB_TEXTEDIT_CHARTYPE  undo_char[STB_TEXTEDIT_UNDOCHARCOUNT];
-   short undo_point, redo_point;
+#endif
+   int undo_point, redo_point;
    int undo_char_point, redo_char_point;
 } StbUndoState;
 
+// [DEAR IMGUI]
+// current size of the undo storage
+#ifdef STB_TEXTEDIT_UNDO_MALLOC
+#define STB_TEXTEDIT_UNDOSTATECOUNT_OF(s)   ((s)->undo_rec_count)
+#define STB_TEXTEDIT_UNDOCHARCOUNT_OF(s)    ((s)->undo_char_count)
+#else
+#define STB_TEXTEDIT_UNDOSTATECOUNT_OF(s)   STB_TEXTEDIT_UNDOSTATECOUNT
+#define STB_TEXTEDIT_UNDOCHARCOUNT_OF(s)    STB_TEXTEDIT_UNDOCHARCOUNT
+#endif
+
 typedef struct
 {
    /////////////////////
@@ -406,6 +442,12 @@ static int stb_text_locate_coord(STB_TEXTEDIT_STRING *str, float x, float y)
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
 
+   // [DEAR IMGUI]
+   // start from a row close to 'y' when the client can find one without laying out the rows above
+#ifdef STB_TEXTEDIT_SKIPROWS_TO_Y
+   i = STB_TEXTEDIT_SKIPROWS_TO_Y(str, y, &base_y);
+#endif
+
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -536,6 +578,11 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
          find->y = 0;
          find->x = 0;
          find->height = 1;
+#ifdef STB_TEXTEDIT_SKIPROWS_TO_CHAR
+         // [DEAR IMGUI]
+         i = STB_TEXTEDIT_SKIPROWS_TO_CHAR(str, n, &find->y);
+         find->y = 0;
+#endif
          while (i < z) {
             STB_TEXTEDIT_LAYOUTROW(&r, str, i);
             prev_start = i;
@@ -551,6 +598,12 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
    // search rows to find the one that straddles character n
    find->y = 0;
 
+   // [DEAR IMGUI]
+   // start from a row close to character n when the client can find one without laying out the rows above
+#ifdef STB_TEXTEDIT_SKIPROWS_TO_CHAR
+   i = STB_TEXTEDIT_SKIPROWS_TO_CHAR(str, n, &find->y);
+#endif
+
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
       if (n < i + r.num_chars)
@@ -1121,10 +1174,81 @@ retry:
 
 static void stb_textedit_flush_redo(StbUndoState *state)
 {
-   state->redo_point = STB_TEXTEDIT_UNDOSTATECOUNT;
-   state->redo_char_point = STB_TEXTEDIT_UNDOCHARCOUNT;
+   state->redo_point = STB_TEXTEDIT_UNDOSTATECOUNT_OF(state);
+   state->redo_char_point = STB_TEXTEDIT_UNDOCHARCOUNT_OF(state);
 }
 
+#ifdef STB_TEXTEDIT_UNDO_MALLOC
+// [DEAR IMGUI]
+// grow the undo storage so that 'rec_gap' records and 'char_gap' characters fit between the
+// undo and redo entries, within STB_TEXTEDIT_UNDOMEMORY bytes. if they still don't fit, the
+// caller discards entries as usual.
+static void stb_textedit_grow_undo(StbUndoState *state, int rec_gap, int char_gap)
+{
+   int rec_count = state->undo_rec_count, char_count = state->undo_char_count;
+   int rec_need = rec_count - (state->redo_point - state->undo_point) + rec_gap;
+   int char_need = char_count - (state->redo_char_point - state->undo_char_point) + char_gap;
+   int new_rec_count = rec_count, new_char_count = char_count, char_reserve, i, n;
+
+   // grow geometrically, starting from the configured counts
+   if (rec_need > rec_count) {
+      new_rec_count = rec_count ? rec_count * 2 : STB_TEXTEDIT_UNDOSTATECOUNT;
+      if (new_rec_count < rec_need)
+         new_rec_count = rec_need;
+   }
+   if (char_need > char_count) {
+      new_char_count = char_count ? char_count * 2 : STB_TEXTEDIT_UNDOCHARCOUNT;
+      if (new_char_count < char_need)
+         new_char_count = char_need;
+   }
+
+   // stay within the memory budget; records never take the room of the initial character storage,
+   // otherwise a run of insertions would leave no characters to redo them with
+   char_reserve = char_count > STB_TEXTEDIT_UNDOCHARCOUNT ? char_count : STB_TEXTEDIT_UNDOCHARCOUNT;
+   if ((size_t) new_rec_count * sizeof(StbUndoRecord) + (size_t) char_reserve * sizeof(STB_TEXTEDIT_CHARTYPE) > (size_t) STB_TEXTEDIT_UNDOMEMORY) {
+      n = (int) (((size_t) STB_TEXTEDIT_UNDOMEMORY - (size_t) char_reserve * sizeof(STB_TEXTEDIT_CHARTYPE)) / sizeof(StbUndoRecord));
+      new_rec_count = (size_t) char_reserve * sizeof(STB_TEXTEDIT_CHARTYPE) < (size_t) STB_TEXTEDIT_UNDOMEMORY && n > rec_count ? n : rec_count;
+   }
+   if ((size_t) new_rec_count * sizeof(StbUndoRecord) + (size_t) new_char_count * sizeof(STB_TEXTEDIT_CHARTYPE) > (size_t) STB_TEXTEDIT_UNDOMEMORY) {
+      n = (int) (((size_t) STB_TEXTEDIT_UNDOMEMORY - (size_t) new_rec_count * sizeof(StbUndoRecord)) / sizeof(STB_TEXTEDIT_CHARTYPE));
+      new_char_count = (size_t) new_rec_count * sizeof(StbUndoRecord) < (size_t) STB_TEXTEDIT_UNDOMEMORY && n > char_count ? n : char_count;
+   }
+
+   // don't grow for characters that can't fit anyway
+   if (new_char_count < char_gap)
+      new_char_count = char_count;
+
+   // move the redo entries to the end of the new storage
+   if (new_rec_count != rec_count) {
+      StbUndoRecord *rec = (StbUndoRecord *) STB_TEXTEDIT_UNDO_MALLOC((size_t) new_rec_count * sizeof(StbUndoRecord));
+      n = new_rec_count - rec_count;
+      if (rec_count) {
+         STB_TEXTEDIT_memmove(rec, state->undo_rec, (size_t) state->undo_point * sizeof(StbUndoRecord));
+         STB_TEXTEDIT_memmove(rec + state->redo_point + n, state->undo_rec + state->redo_point, (size_t) (rec_count - state->redo_point) * sizeof(StbUndoRecord));
+         STB_TEXTEDIT_UNDO_FREE(state->undo_rec);
+      }
+      state->undo_rec = rec;
+      state->undo_rec_count = new_rec_count;
+      state->redo_point += n;
+   }
+   if (new_char_count != char_count) {
+      STB_TEXTEDIT_CHARTYPE *chars = (STB_TEXTEDIT_CHARTYPE *) STB_TEXTEDIT_UNDO_MALLOC((size_t) new_char_count * sizeof(STB_TEXTEDIT_CHARTYPE));
+      n = new_char_count - char_count;
+      if (char_count) {
+         STB_TEXTEDIT_memmove(chars, state->undo_char, (size_t) state->undo_char_point * sizeof(STB_TEXTEDIT_CHARTYPE));
+         STB_TEXTEDIT_memmove(chars + state->redo_char_point + n, state->undo_char + state->redo_char_point, (size_t) (char_count - state->redo_char_point) * sizeof(STB_TEXTEDIT_CHARTYPE));
+         STB_TEXTEDIT_UNDO_FREE(state->undo_char);
+      }
+      state->undo_char = chars;
+      state->undo_char_count = new_char_count;
+      state->redo_char_point += n;
+      for (i = state->redo_point; i < state->undo_rec_count; ++i)
+         if (state->undo_rec[i].char_storage >= 0)
+            state->undo_rec[i].char_storage += n;
+   }
+}
+#endif
+
 // discard the oldest entry in the undo list
 static void stb_textedit_discard_undo(StbUndoState *state)
 {
@@ -1150,7 +1274,7 @@ static void stb_textedit_discard_undo(StbUndoState *state)
 // fill up even though the undo buffer didn't
 static void stb_textedit_discard_redo(StbUndoState *state)
 {
-   int k = STB_TEXTEDIT_UNDOSTATECOUNT-1;
+   int k = STB_TEXTEDIT_UNDOSTATECOUNT_OF(state)-1;
 
    if (state->redo_point <= k) {
       // if the k'th undo state has characters, clean those up
@@ -1158,7 +1282,7 @@ static void stb_textedit_discard_redo(StbUndoState *state)
          int n = state->undo_rec[k].insert_length, i;
          // move the remaining redo character data to the end of the buffer
          state->redo_char_point += n;
-         STB_TEXTEDIT_memmove(state->undo_char + state->redo_char_point, state->undo_char + state->redo_char_point-n, (size_t) ((STB_TEXTEDIT_UNDOCHARCOUNT - state->redo_char_point)*sizeof(STB_TEXTEDIT_CHARTYPE)));
+         STB_TEXTEDIT_memmove(state->undo_char + state->redo_char_point, state->undo_char + state->redo_char_point-n, (size_t) ((STB_TEXTEDIT_UNDOCHARCOUNT_OF(state) - state->redo_char_point)*sizeof(STB_TEXTEDIT_CHARTYPE)));
          // adjust the position of all the other records to account for above memmove
          for (i=state->redo_point; i < k; ++i)
             if (state->undo_rec[i].char_storage >= 0)
@@ -1166,9 +1290,9 @@ static void stb_textedit_discard_redo(StbUndoState *state)
       }
       // now move all the redo records towards the end of the buffer; the first one is at 'redo_point'
       // [DEAR IMGUI]
-      size_t move_size = (size_t)((STB_TEXTEDIT_UNDOSTATECOUNT - state->redo_point - 1) * sizeof(state->undo_rec[0]));
+      size_t move_size = (size_t)((STB_TEXTEDIT_UNDOSTATECOUNT_OF(state) - state->redo_point - 1) * sizeof(state->undo_rec[0]));
       const char* buf_begin = (char*)state->undo_rec; (void)buf_begin;
-      const char* buf_end   = (char*)state->undo_rec + sizeof(state->undo_rec); (void)buf_end;
+      const char* buf_end   = (char*)(state->undo_rec + STB_TEXTEDIT_UNDOSTATECOUNT_OF(state)); (void)buf_end;
       IM_ASSERT(((char*)(state->undo_rec + state->redo_point)) >= buf_begin);
       IM_ASSERT(((char*)(state->undo_rec + state->redo_point + 1) + move_size) <= buf_end);
       STB_TEXTEDIT_memmove(state->undo_rec + state->redo_point+1, state->undo_rec + state->redo_point, move_size);
@@ -1183,20 +1307,28 @@ static StbUndoRecord *stb_text_create_undo_record(StbUndoState *state, int numch
    // any time we create a new undo record, we discard redo
    stb_textedit_flush_redo(state);
 
+#ifdef STB_TEXTEDIT_UNDO_MALLOC
+   // [DEAR IMGUI]
+   // make room by growing the storage first
+   stb_textedit_grow_undo(state, 1, numchars);
+   if (state->undo_rec_count == 0)
+      return NULL;
+#endif
+
    // if we have no free records, we have to make room, by sliding the
    // existing records down
-   if (state->undo_point == STB_TEXTEDIT_UNDOSTATECOUNT)
+   if (state->undo_point == STB_TEXTEDIT_UNDOSTATECOUNT_OF(state))
       stb_textedit_discard_undo(state);
 
    // if the characters to store won't possibly fit in the buffer, we can't undo
-   if (numchars > STB_TEXTEDIT_UNDOCHARCOUNT) {
+   if (numchars > STB_TEXTEDIT_UNDOCHARCOUNT_OF(state)) {
       state->undo_point = 0;
       state->undo_char_point = 0;
       return NULL;
    }
 
    // if we don't have enough free characters in the buffer, we have to make room
-   while (state->undo_char_point + numchars > STB_TEXTEDIT_UNDOCHARCOUNT)
+   while (state->undo_char_point + numchars > STB_TEXTEDIT_UNDOCHARCOUNT_OF(state))
       stb_textedit_discard_undo(state);
 
    return &state->undo_rec[state->undo_point++];
@@ -1229,6 +1361,13 @@ static void stb_text_undo(STB_TEXTEDIT_STRING *str, STB_TexteditState *state)
    if (s->undo_point == 0)
       return;
 
+#ifdef STB_TEXTEDIT_UNDO_MALLOC
+   // [DEAR IMGUI]
+   // make room for the characters of the redo record by growing the storage first
+   if (s->undo_rec[s->undo_point-1].delete_length)
+      stb_textedit_grow_undo(s, 0, s->undo_rec[s->undo_point-1].delete_length);
+#endif
+
    // we need to do two things: apply the undo record, and create a redo record
    u = s->undo_rec[s->undo_point-1];
    r = &s->undo_rec[s->redo_point-1];
@@ -1249,7 +1388,7 @@ static void stb_text_undo(STB_TEXTEDIT_STRING *str, STB_TexteditState *state)
       //    characters stored for *undoing* don't leave room for redo
       // if the last is true, we have to bail
 
-      if (s->undo_char_point + u.delete_length >= STB_TEXTEDIT_UNDOCHARCOUNT) {
+      if (s->undo_char_point + u.delete_length >= STB_TEXTEDIT_UNDOCHARCOUNT_OF(s)) {
          // the undo records take up too much character space; there's no space to store the redo characters
          r->insert_length = 0;
       } else {
@@ -1258,7 +1397,7 @@ static void stb_text_undo(STB_TEXTEDIT_STRING *str, STB_TexteditState *state)
          // there's definitely room to store the characters eventually
          while (s->undo_char_point + u.delete_length > s->redo_char_point) {
             // should never happen:
-            if (s->redo_point == STB_TEXTEDIT_UNDOSTATECOUNT)
+            if (s->redo_point == STB_TEXTEDIT_UNDOSTATECOUNT_OF(s))
                return;
             // there's currently not enough room, so discard a redo record
             stb_textedit_discard_redo(s);
@@ -1294,9 +1433,16 @@ static void stb_text_redo(STB_TEXTEDIT_STRING *str, STB_TexteditState *state)
 {
    StbUndoState *s = &state->undostate;
    StbUndoRecord *u, r;
-   if (s->redo_point == STB_TEXTEDIT_UNDOSTATECOUNT)
+   if (s->redo_point == STB_TEXTEDIT_UNDOSTATECOUNT_OF(s))
       return;
 
+#ifdef STB_TEXTEDIT_UNDO_MALLOC
+   // [DEAR IMGUI]
+   // make room for the characters of the undo record by growing the storage first
+   if (s->undo_rec[s->redo_point].delete_length)
+      stb_textedit_grow_undo(s, 0, s->undo_rec[s->redo_point].delete_length);
+#endif
+
    // we need to do two things: apply the redo record, and create an undo record
    u = &s->undo_rec[s->undo_point];
    r = s->undo_rec[s->redo_point];
@@ -1369,10 +1515,21 @@ static void stb_text_makeundo_replace(STB_TEXTEDIT_STRING *str, STB_TexteditStat
 // reset the state to default
 static void stb_textedit_clear_state(STB_TexteditState *state, int is_single_line)
 {
+#ifdef STB_TEXTEDIT_UNDO_MALLOC
+   // [DEAR IMGUI]
+   // storage is allocated again on the first edit
+   if (state->undostate.undo_rec)
+      STB_TEXTEDIT_UNDO_FREE(state->undostate.undo_rec);
+   if (state->undostate.undo_char)
+      STB_TEXTEDIT_UNDO_FREE(state->undostate.undo_char);
+   state->undostate.undo_rec = NULL;
+   state->undostate.undo_char = NULL;
+   state->undostate.undo_rec_count = state->undostate.undo_char_count = 0;
+#endif
    state->undostate.undo_point = 0;
    state->undostate.undo_char_point = 0;
-   state->undostate.redo_point = STB_TEXTEDIT_UNDOSTATECOUNT;
-   state->undostate.redo_char_point = STB_TEXTEDIT_UNDOCHARCOUNT;
+   state->undostate.redo_point = STB_TEXTEDIT_UNDOSTATECOUNT_OF(&state->undostate);
+   state->undostate.redo_char_point = STB_TEXTEDIT_UNDOCHARCOUNT_OF(&state->undostate);
    state->select_end = state->select_start = 0;
    state->cursor = 0;
    state->has_preferred_x = 0;
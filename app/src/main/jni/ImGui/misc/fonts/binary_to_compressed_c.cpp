@@ -0,0 +1,324 @@
+// dear imgui
+// (binary_to_compressed_c.cpp)
+// Helper tool to turn a file into a C array, if you want to embed font data in your source code.
+
+// The data is first compressed in the stb_compress() format to reduce binary size,
+// then output as an array of 32-bit constants, or encoded in Base85 to fit in a string so we can fit roughly 4 bytes of compressed data into 5 bytes of source code (suggested by @mmalex)
+// (32-bit constants take 11 bytes of source code to encode 4 bytes and are endianness dependent, but the data is decompressed straight from the array without an intermediate copy)
+// Load compressed TTF fonts with ImGui::GetIO().Fonts->AddFontFromMemoryCompressedTTF() or AddFontFromMemoryCompressedBase85TTF()
+
+// Build with, e.g:
+//   # cl.exe binary_to_compressed_c.cpp
+//   # g++ -O2 binary_to_compressed_c.cpp
+//   # clang++ -O2 binary_to_compressed_c.cpp
+// This tool is not part of the library: don't add it to your project sources.
+
+// Usage:
+//   binary_to_compressed_c.exe [-base85] [-nocompress] [-nostatic] <inputfile> <symbolname>
+// Usage example:
+//   # binary_to_compressed_c.exe myfont.ttf MyFont > myfont.cpp
+//   # binary_to_compressed_c.exe -base85 myfont.ttf MyFont > myfont.cpp
+
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+typedef unsigned int stb_uint;
+typedef unsigned char stb_uchar;
+static stb_uint stb_compress(stb_uchar* out, const stb_uchar* in, stb_uint len);
+static stb_uint stb_compress_bound(stb_uint len);
+
+static bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_base85_encoding, bool use_compression, bool use_static);
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        printf("Syntax: %s [-base85] [-nocompress] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
+        return 0;
+    }
+
+    int argn = 1;
+    bool use_base85_encoding = false;
+    bool use_compression = true;
+    bool use_static = true;
+    while (argn < argc && argv[argn][0] == '-')
+    {
+        if (strcmp(argv[argn], "-base85") == 0) { use_base85_encoding = true; argn++; }
+        else if (strcmp(argv[argn], "-nocompress") == 0) { use_compression = false; argn++; }
+        else if (strcmp(argv[argn], "-nostatic") == 0) { use_static = false; argn++; }
+        else
+        {
+            fprintf(stderr, "Unknown argument: '%s'\n", argv[argn]);
+            return 1;
+        }
+    }
+    if (argn + 2 > argc)
+    {
+        fprintf(stderr, "Missing <inputfile> or <symbolname>\n");
+        return 1;
+    }
+
+    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], use_base85_encoding, use_compression, use_static);
+    if (!ret)
+        fprintf(stderr, "Error opening or reading file: '%s'\n", argv[argn]);
+    return ret ? 0 : 1;
+}
+
+static char Encode85Byte(unsigned int x)
+{
+    x = (x % 85) + 35;
+    return (char)((x >= '\\') ? x + 1 : x);
+}
+
+bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_base85_encoding, bool use_compression, bool use_static)
+{
+    // Read file
+    FILE* f = fopen(filename, "rb");
+    if (!f) return false;
+    int data_sz;
+    if (fseek(f, 0, SEEK_END) || (data_sz = (int)ftell(f)) == -1 || fseek(f, 0, SEEK_SET)) { fclose(f); return false; }
+    char* data = (char*)malloc(data_sz + 4);
+    if (fread(data, 1, data_sz, f) != (size_t)data_sz) { fclose(f); free(data); return false; }
+    memset((void*)(((char*)data) + data_sz), 0, 4);
+    fclose(f);
+
+    // Compress
+    int maxlen = (int)stb_compress_bound((stb_uint)data_sz);
+    char* compressed = use_compression ? (char*)malloc(maxlen + 4) : data;
+    int compressed_sz = use_compression ? (int)stb_compress((stb_uchar*)compressed, (const stb_uchar*)data, (stb_uint)data_sz) : data_sz;
+    if (use_compression)
+        memset(compressed + compressed_sz, 0, maxlen + 4 - compressed_sz);
+
+    // Output as Base85 encoded
+    FILE* out = stdout;
+    fprintf(out, "// File: '%s' (%d bytes)\n", filename, (int)data_sz);
+    fprintf(out, "// Exported using binary_to_compressed_c.cpp\n");
+    const char* static_str = use_static ? "static " : "";
+    const char* compressed_str = use_compression ? "compressed_" : "";
+    if (use_base85_encoding)
+    {
+        fprintf(out, "%sconst char %s_%sdata_base85[%d+1] =\n    \"", static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*5);
+        char prev_c = 0;
+        for (int src_i = 0; src_i < compressed_sz; src_i += 4)
+        {
+            // This is made a little more complicated by the fact that ??X sequences are interpreted as trigraphs by old C/C++ compilers. So we need to escape pairs of ??.
+            unsigned int d = *(unsigned int*)(compressed + src_i);
+            for (unsigned int n5 = 0; n5 < 5; n5++, d /= 85)
+            {
+                char c = Encode85Byte(d);
+                fprintf(out, (c == '?' && prev_c == '?') ? "\\%c" : "%c", c);
+                prev_c = c;
+            }
+            if ((src_i % 112) == 112 - 4)
+                fprintf(out, "\"\n    \"");
+        }
+        fprintf(out, "\";\n\n");
+    }
+    else
+    {
+        fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
+        fprintf(out, "%sconst unsigned int %s_%sdata[%d/4] =\n{", static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*4);
+        int column = 0;
+        for (int i = 0; i < compressed_sz; i += 4)
+        {
+            unsigned int d = *(unsigned int*)(compressed + i);
+            if ((column++ % 12) == 0)
+                fprintf(out, "\n    0x%08x, ", d);
+            else
+                fprintf(out, "0x%08x, ", d);
+        }
+        fprintf(out, "\n};\n\n");
+    }
+    if (use_compression)
+        fprintf(stderr, "%s: %d -> %d bytes (%.1f%%)\n", filename, data_sz, compressed_sz, compressed_sz * 100.0 / data_sz);
+
+    // Cleanup
+    free(data);
+    if (use_compression)
+        free(compressed);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Compressor for the stb_compress() format (from stb.h by Sean Barrett), decompressed by stb_decompress() in imgui_draw.cpp.
+//-----------------------------------------------------------------------------
+// Stream: 0x57 0xBC 0x00 0x00, 0 (4 bytes), uncompressed length (4 bytes), window size (4 bytes), tokens, 0x05 0xFA, adler32 of the uncompressed data (4 bytes).
+// Multi-bytes values are big-endian. Tokens are either a run of literal bytes or a back-reference (distance, length) into the already decompressed data:
+//   0x20..0x3F: 1-32 literals     0x08..0x0F: 1-2048 literals    0x07: 1-65536 literals
+//   0x80..0xFF: dist <= 256, len <= 128     0x40..0x7F: dist <= 16K, len <= 256
+//   0x18..0x1F: dist <= 512K, len <= 256    0x10..0x17: dist <= 512K, len <= 64K
+//   0x06:       dist <= 16M, len <= 256     0x04:       dist <= 16M, len <= 64K
+// We find the longest back-reference at each position with hash chains, check if starting it one byte later saves more (lazy matching),
+// and emit it with the shortest token which can encode it.
+//-----------------------------------------------------------------------------
+
+static const int STB_WINDOW = 0xFFFFFF;
+static const int STB_MAX_MATCH = 0x10000;
+static const int STB_HASH_BITS = 16;
+static const int STB_CHAIN_DEPTH = 4096;
+
+struct stb_compressor
+{
+    const stb_uchar*    In;
+    int                 InLen;
+    int*                Head;       // Most recent position for each hash
+    int*                Prev;       // Previous position with the same hash, for each position
+    int                 Inserted;   // Positions < Inserted are in the hash chains
+    stb_uchar*          Out;
+};
+
+static stb_uint stb_adler32(stb_uint adler32, const stb_uchar* buffer, stb_uint buflen)
+{
+    const unsigned long ADLER_MOD = 65521;
+    unsigned long s1 = adler32 & 0xffff, s2 = adler32 >> 16;
+    while (buflen)
+    {
+        stb_uint blocklen = buflen < 5552 ? buflen : 5552;
+        for (stb_uint i = 0; i < blocklen; i++)
+            s1 += *buffer++, s2 += s1;
+        s1 %= ADLER_MOD, s2 %= ADLER_MOD;
+        buflen -= blocklen;
+    }
+    return (stb_uint)(s2 << 16) + (stb_uint)s1;
+}
+
+static void stb_out(stb_compressor* c, stb_uint v)  { *c->Out++ = (stb_uchar)v; }
+static void stb_out2(stb_compressor* c, stb_uint v) { stb_out(c, v >> 8); stb_out(c, v); }
+static void stb_out3(stb_compressor* c, stb_uint v) { stb_out(c, v >> 16); stb_out(c, v >> 8); stb_out(c, v); }
+static void stb_out4(stb_compressor* c, stb_uint v) { stb_out(c, v >> 24); stb_out(c, v >> 16); stb_out(c, v >> 8); stb_out(c, v); }
+
+static int stb_match_cost(int dist, int len)
+{
+    if (dist <= 256 && len <= 128)      return 2;
+    if (dist <= 0x4000 && len <= 256)   return 3;
+    if (dist <= 0x80000 && len <= 256)  return 4;
+    if (dist <= 0x80000)                return 5;
+    return (len <= 256) ? 5 : 6;
+}
+
+static stb_uint stb_hash3(const stb_uchar* p)
+{
+    return (((stb_uint)p[0] << 16) | ((stb_uint)p[1] << 8) | p[2]) * 2654435761u >> (32 - STB_HASH_BITS);
+}
+
+static void stb_insert_until(stb_compressor* c, int pos)
+{
+    for (; c->Inserted < pos && c->Inserted + 3 <= c->InLen; c->Inserted++)
+    {
+        stb_uint h = stb_hash3(c->In + c->Inserted);
+        c->Prev[c->Inserted] = c->Head[h];
+        c->Head[h] = c->Inserted;
+    }
+}
+
+// Return the length of the back-reference saving the most bytes at 'pos' (0 if none saves anything)
+static int stb_find_match(stb_compressor* c, int pos, int* out_dist)
+{
+    if (pos + 3 > c->InLen)
+        return 0;
+    const stb_uchar* in = c->In;
+    const int max_len = (c->InLen - pos < STB_MAX_MATCH) ? c->InLen - pos : STB_MAX_MATCH;
+    int best_len = 0, best_gain = 0, chain = STB_CHAIN_DEPTH;
+    for (int cand = c->Head[stb_hash3(in + pos)]; cand >= 0 && pos - cand <= STB_WINDOW && chain-- > 0; cand = c->Prev[cand])
+    {
+        if (in[cand + best_len] != in[pos + best_len])
+            continue;
+        int len = 0;
+        while (len < max_len && in[cand + len] == in[pos + len])
+            len++;
+        const int gain = len - stb_match_cost(pos - cand, len);
+        if (gain > best_gain)
+        {
+            best_gain = gain;
+            best_len = len;
+            *out_dist = pos - cand;
+            if (len == max_len)
+                break;
+        }
+    }
+    return best_len;
+}
+
+static void stb_out_literals(stb_compressor* c, const stb_uchar* p, int n)
+{
+    while (n > 0)
+    {
+        int run = (n < 0x10000) ? n : 0x10000;
+        if (run <= 32)          stb_out(c, 0x20 + run - 1);
+        else if (run <= 2048)   stb_out2(c, 0x0800 + run - 1);
+        else                    { stb_out(c, 0x07); stb_out2(c, run - 1); }
+        memcpy(c->Out, p, run);
+        c->Out += run;
+        p += run;
+        n -= run;
+    }
+}
+
+static void stb_out_match(stb_compressor* c, int dist, int len)
+{
+    if (dist <= 256 && len <= 128)      { stb_out(c, 0x80 + len - 1); stb_out(c, dist - 1); }
+    else if (dist <= 0x4000 && len <= 256)  { stb_out2(c, 0x4000 + dist - 1); stb_out(c, len - 1); }
+    else if (dist <= 0x80000 && len <= 256) { stb_out3(c, 0x180000 + dist - 1); stb_out(c, len - 1); }
+    else if (dist <= 0x80000)           { stb_out3(c, 0x100000 + dist - 1); stb_out2(c, len - 1); }
+    else if (len <= 256)                { stb_out(c, 0x06); stb_out3(c, dist - 1); stb_out(c, len - 1); }
+    else                                { stb_out(c, 0x04); stb_out3(c, dist - 1); stb_out2(c, len - 1); }
+}
+
+// Worst case: only literals, with a 3 bytes header every 64K + stream header and footer
+static stb_uint stb_compress_bound(stb_uint len)
+{
+    return len + (len / 0x10000 + 1) * 3 + 16 + 6;
+}
+
+static stb_uint stb_compress(stb_uchar* out, const stb_uchar* in, stb_uint len)
+{
+    stb_compressor c;
+    c.In = in;
+    c.InLen = (int)len;
+    c.Head = (int*)malloc(sizeof(int) << STB_HASH_BITS);
+    c.Prev = (int*)malloc(sizeof(int) * (len + 1));
+    c.Inserted = 0;
+    c.Out = out;
+    memset(c.Head, 0xFF, sizeof(int) << STB_HASH_BITS);
+
+    stb_out(&c, 0x57); stb_out(&c, 0xBC); stb_out2(&c, 0);
+    stb_out4(&c, 0);
+    stb_out4(&c, len);
+    stb_out4(&c, STB_WINDOW);
+
+    int pos = 0, literals_start = 0;
+    while (pos < (int)len)
+    {
+        stb_insert_until(&c, pos);
+        int dist = 0;
+        int match_len = stb_find_match(&c, pos, &dist);
+        if (match_len > 0 && match_len < STB_MAX_MATCH)
+        {
+            // Lazy matching: emit a literal if the back-reference starting at the next position saves more
+            stb_insert_until(&c, pos + 1);
+            int next_dist = 0;
+            int next_len = stb_find_match(&c, pos + 1, &next_dist);
+            if (next_len - stb_match_cost(next_dist, next_len) > match_len - stb_match_cost(dist, match_len) + 1)
+                match_len = 0;
+        }
+        if (match_len == 0)
+        {
+            pos++;
+            continue;
+        }
+        stb_out_literals(&c, in + literals_start, pos - literals_start);
+        stb_out_match(&c, dist, match_len);
+        pos += match_len;
+        literals_start = pos;
+    }
+    stb_out_literals(&c, in + literals_start, (int)len - literals_start);
+
+    stb_out(&c, 0x05); stb_out(&c, 0xFA);
+    stb_out4(&c, stb_adler32(1, in, len));
+
+    free(c.Head);
+    free(c.Prev);
+    return (stb_uint)(c.Out - out);
+}
@@ -0,0 +1,222 @@
+// dear imgui
+// (hash_benchmark.cpp)
+// Benchmark and check for the hash function used by ImHashStr()/ImHashData(), selected at compile time (see IMGUI_USE_HW_CRC32 and IMGUI_USE_FAST_HASH in imconfig.h).
+// A corpus of labels and IDs similar to what a UI submits every frame is hashed in a loop, and the number of IDs per second is reported.
+// The IDs are also checked against reference implementations:
+// - the default table CRC32 and IMGUI_USE_HW_CRC32 on ARM must produce the same IDs as a bitwise CRC32.
+// - IMGUI_USE_HW_CRC32 on x86 (SSE 4.2) must produce the same IDs as a bitwise CRC32C.
+// - all backends must honor the '###' operator (hashing restarts from the seed at the last '###'), seed chaining, and hash strings
+//   the same way with an explicit length or zero-terminated.
+
+// Build from this folder, once per backend (the same defines must be used for this file and for imgui.cpp), with e.g:
+//   # g++ -O2 -I../.. hash_benchmark.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp
+//   # g++ -O2 -I../.. -msse4.2 -DIMGUI_USE_HW_CRC32 hash_benchmark.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp
+//   # g++ -O2 -I../.. -march=armv8-a+crc -DIMGUI_USE_HW_CRC32 hash_benchmark.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp
+//   # g++ -O2 -I../.. -DIMGUI_USE_FAST_HASH hash_benchmark.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp
+// This tool is not part of the library: don't add it to your project sources.
+
+// Usage:
+//   hash_benchmark.exe [iterations]
+// Returns 0 if all checks passed, 1 otherwise.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#if defined(IMGUI_USE_FAST_HASH)
+static const char* BackendName = "IMGUI_USE_FAST_HASH (word-at-a-time)";
+#elif defined(IMGUI_ENABLE_ARM_CRC32)
+static const char* BackendName = "IMGUI_USE_HW_CRC32 (ARMv8 CRC32)";
+#elif defined(IMGUI_ENABLE_SSE42_CRC32)
+static const char* BackendName = "IMGUI_USE_HW_CRC32 (SSE 4.2 CRC32C)";
+#else
+static const char* BackendName = "default (table CRC32)";
+#endif
+
+// Reference bitwise CRC, with the same seed convention as ImHashData()
+static ImU32 RefCrc(const void* data_p, size_t data_size, ImU32 seed, ImU32 poly)
+{
+    ImU32 crc = ~seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+    while (data_size-- != 0)
+    {
+        crc ^= *data++;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ ((crc & 1) ? poly : 0);
+    }
+    return ~crc;
+}
+
+// Start of the part of the string which is hashed by ImHashStr(): the last "###" (including overlapping ones, e.g. "####"), or the whole string
+static size_t RefHashStrStart(const char* str, size_t str_size)
+{
+    size_t start = 0;
+    for (size_t n = 0; n + 3 <= str_size; n++)
+        if (str[n] == '#' && str[n + 1] == '#' && str[n + 2] == '#')
+            start = n;
+    return start;
+}
+
+static int Errors = 0;
+
+static void CheckID(const char* desc, const char* str, ImGuiID id, ImGuiID expected_id)
+{
+    if (id == expected_id)
+        return;
+    if (Errors < 20)
+        printf("FAILED: %s \"%s\": 0x%08X, expected 0x%08X\n", desc, str, id, expected_id);
+    Errors++;
+}
+
+static void MakeCorpus(std::vector<std::string>& labels)
+{
+    static const char* words[] = { "File", "Edit", "View", "Open", "Save", "Close", "Options", "Settings", "Color", "Size", "Position", "Name", "Enabled", "Delete", "Apply", "Cancel", "Tree", "Node", "Table", "Column" };
+    static const char* utf8_words[] = { "\xC3\x89" "diter", "\xD0\x9F\xD1\x80\xD0\xB0\xD0\xB2\xD0\xBA\xD0\xB0", "\xE8\xA8\xAD\xE5\xAE\x9A", "\xF0\x9F\x94\x8D Search" };
+    const int words_count = IM_ARRAYSIZE(words);
+    unsigned int rng = 12345;
+    for (int n = 0; n < 4096; n++)
+    {
+        rng = rng * 1103515245 + 12345;
+        const unsigned int r = rng >> 8;
+        const char* a = words[r % words_count];
+        const char* b = words[(r / words_count) % words_count];
+        char buf[256];
+        switch (r % 10)
+        {
+        case 0: case 1: case 2: snprintf(buf, sizeof(buf), "%s", a); break;                                     // Short label
+        case 3:         snprintf(buf, sizeof(buf), "%s %s", a, b); break;                                       // Two words
+        case 4:         snprintf(buf, sizeof(buf), "%s##%s%d", a, b, n); break;                                 // Hidden suffix
+        case 5:         snprintf(buf, sizeof(buf), "%s %d###%s", a, n, b); break;                               // Stable ID with a changing label
+        case 6:         snprintf(buf, sizeof(buf), "%s %d", a, n); break;                                       // Numbered item
+        case 7:         snprintf(buf, sizeof(buf), "%s", utf8_words[r % IM_ARRAYSIZE(utf8_words)]); break;      // Non-ASCII
+        case 8:         snprintf(buf, sizeof(buf), "%s: a longer label, as found in tooltips and text items %d", a, n); break;
+        default:        snprintf(buf, sizeof(buf), "##%s", a); break;                                           // Hidden label
+        }
+        labels.push_back(buf);
+    }
+
+    // Corner cases of the '###' operator
+    static const char* specials[] = { "", "#", "##", "###", "####", "#####", "a###", "###a", "a###b###c", "a####b", "a#####b", "###a###", "a#b##c###d", "ab#", "ab##" };
+    for (int n = 0; n < IM_ARRAYSIZE(specials); n++)
+        labels.push_back(specials[n]);
+}
+
+static void CheckCorpus(const std::vector<std::string>& labels)
+{
+#if defined(IMGUI_ENABLE_SSE42_CRC32)
+    const bool has_ref = true;
+    const ImU32 ref_poly = 0x82F63B78; // CRC32C
+#elif defined(IMGUI_USE_FAST_HASH)
+    const bool has_ref = false;
+    const ImU32 ref_poly = 0;
+#else
+    const bool has_ref = true;
+    const ImU32 ref_poly = 0xEDB88320; // CRC32
+#endif
+    const ImU32 seeds[] = { 0, 1, 0x12345678, 0xFFFFFFFF };
+    for (size_t label_n = 0; label_n < labels.size(); label_n++)
+    {
+        const char* str = labels[label_n].c_str();
+        const size_t str_size = labels[label_n].size();
+        const size_t start = RefHashStrStart(str, str_size);
+        for (int seed_n = 0; seed_n < IM_ARRAYSIZE(seeds); seed_n++)
+        {
+            const ImU32 seed = seeds[seed_n];
+            const ImGuiID id = ImHashStr(str, 0, seed);
+            if (str_size > 0)
+                CheckID("ImHashStr() with explicit length", str, ImHashStr(str, str_size, seed), id);
+            CheckID("ImHashStr() vs ImHashData() from the last ###", str, ImHashData(str + start, str_size - start, seed), id);
+            if (start > 0)
+                CheckID("ImHashStr() vs ImHashStr() of the ### suffix", str, ImHashStr(str + start, 0, seed), id);
+            if (has_ref)
+            {
+                CheckID("ImHashStr() vs reference", str, id, RefCrc(str + start, str_size - start, seed, ref_poly));
+                CheckID("ImHashData() vs reference", str, ImHashData(str, str_size, seed), RefCrc(str, str_size, seed, ref_poly));
+            }
+        }
+
+        // Seed chaining, as done by PushID()/GetID()
+        const ImGuiID parent_id = ImHashStr("Window", 0, 0);
+        const ImGuiID child_id = ImHashStr(str, 0, ImHashStr("Parent", 0, parent_id));
+        if (has_ref)
+            CheckID("chained ImHashStr() vs reference", str, child_id, RefCrc(str + start, str_size - start, RefCrc("Parent", 6, RefCrc("Window", 6, 0, ref_poly), ref_poly), ref_poly));
+    }
+
+    // Pointer and integer IDs, as hashed by PushID()/GetID()
+    for (int n = 0; n < 10000; n++)
+    {
+        const void* ptr = (const char*)&labels + n * 16;
+        if (has_ref)
+        {
+            CheckID("ImHashData() of an int vs reference", "int", ImHashData(&n, sizeof(n), 0x12345678), RefCrc(&n, sizeof(n), 0x12345678, ref_poly));
+            CheckID("ImHashData() of a pointer vs reference", "ptr", ImHashData(&ptr, sizeof(ptr), 0x12345678), RefCrc(&ptr, sizeof(ptr), 0x12345678, ref_poly));
+        }
+        else
+        {
+            CheckID("ImHashData() of an int is deterministic", "int", ImHashData(&n, sizeof(n), 0x12345678), ImHashData(&n, sizeof(n), 0x12345678));
+        }
+    }
+}
+
+typedef std::chrono::high_resolution_clock Clock;
+
+static void Report(const char* desc, size_t ids_count, Clock::time_point t0, ImU32 sum)
+{
+    const double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+    printf("  %-40s %8.1f M IDs/s (sum 0x%08X)\n", desc, ids_count / seconds / 1e6, sum);
+}
+
+int main(int argc, char** argv)
+{
+    const int iterations = (argc > 1) ? atoi(argv[1]) : 1000;
+    printf("Backend: %s\n", BackendName);
+
+    std::vector<std::string> labels;
+    MakeCorpus(labels);
+    size_t labels_bytes = 0;
+    for (size_t n = 0; n < labels.size(); n++)
+        labels_bytes += labels[n].size();
+    CheckCorpus(labels);
+    printf("Checks: %d label(s), %d error(s)\n", (int)labels.size(), Errors);
+
+    // Benchmarks. The sum of all IDs is printed to keep the work from being optimized out, and is stable for a given backend.
+    printf("Benchmark: %d label(s), %.1f bytes on average, %d iteration(s)\n", (int)labels.size(), (double)labels_bytes / labels.size(), iterations);
+    ImU32 sum = 0;
+    Clock::time_point t0 = Clock::now();
+    for (int it = 0; it < iterations; it++)
+        for (size_t n = 0; n < labels.size(); n++)
+            sum += ImHashStr(labels[n].c_str(), 0, (ImU32)it);
+    Report("ImHashStr(), zero-terminated labels", labels.size() * iterations, t0, sum);
+
+    sum = 0;
+    t0 = Clock::now();
+    for (int it = 0; it < iterations; it++)
+        for (size_t n = 0; n < labels.size(); n++)
+            sum += ImHashStr(labels[n].c_str(), labels[n].size(), (ImU32)it);
+    Report("ImHashStr(), labels with length", labels.size() * iterations, t0, sum);
+
+    sum = 0;
+    t0 = Clock::now();
+    for (int it = 0; it < iterations; it++)
+        for (int n = 0; n < (int)labels.size(); n++)
+            sum += ImHashData(&n, sizeof(n), (ImU32)it);
+    Report("ImHashData(), int IDs", labels.size() * iterations, t0, sum);
+
+    sum = 0;
+    t0 = Clock::now();
+    for (int it = 0; it < iterations; it++)
+        for (size_t n = 0; n < labels.size(); n++)
+        {
+            const void* ptr = &labels[n];
+            sum += ImHashData(&ptr, sizeof(ptr), (ImU32)it);
+        }
+    Report("ImHashData(), pointer IDs", labels.size() * iterations, t0, sum);
+
+    printf("%s\n", Errors ? "FAILED" : "All checks passed");
+    return Errors ? 1 : 0;
+}
@@ -0,0 +1,170 @@
+// dear imgui
+// (polyline_test.cpp)
+// Test and benchmark for the anti-aliased ImDrawList::AddPolyline() paths, which process 4 points at a time with SSE or NEON when enabled.
+// The vertices of a point only depend on the point and its two neighbors, so every point of a long polyline (mostly handled by the SIMD code)
+// is compared with the middle point of a 3 points polyline (always handled by the scalar code), which must be bit-identical.
+// This covers the texture-based, thin and thick paths, open and closed polylines, and degenerate/sharp corners.
+
+// Build from this folder with, e.g:
+//   # g++ -O2 -I../.. polyline_test.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp                                      (SSE on x86)
+//   # g++ -O2 -I../.. -DIMGUI_USE_NEON polyline_test.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp                      (NEON on AArch64)
+//   # g++ -O2 -I../.. -DIMGUI_DISABLE_SSE polyline_test.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp                   (scalar, for the benchmark)
+// This tool is not part of the library: don't add it to your project sources.
+
+// Usage:
+//   polyline_test.exe [iterations]
+// Returns 0 if all checks passed, 1 otherwise.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#if defined(IMGUI_ENABLE_SSE)
+static const char* SimdName = "SSE";
+#elif defined(IMGUI_ENABLE_NEON)
+static const char* SimdName = "NEON";
+#else
+static const char* SimdName = "none (scalar)";
+#endif
+
+struct PolylineMode
+{
+    const char*         Desc;
+    ImDrawListFlags     Flags;
+    float               Thickness;
+};
+
+static const PolylineMode Modes[] =
+{
+    { "texture-based, thickness 1", ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex, 1.0f },
+    { "texture-based, thickness 3", ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex, 3.0f },
+    { "thin, thickness 1",          ImDrawListFlags_AntiAliasedLines, 1.0f },
+    { "thin, thickness 0.5",        ImDrawListFlags_AntiAliasedLines, 0.5f },
+    { "thick, thickness 2.5",       ImDrawListFlags_AntiAliasedLines, 2.5f },
+    { "thick, thickness 7",         ImDrawListFlags_AntiAliasedLines, 7.0f },
+};
+
+static unsigned int Rng = 12345;
+static float RandomFloat(float min, float max) { Rng = Rng * 1103515245 + 12345; return min + (max - min) * (float)((Rng >> 8) & 0xFFFF) / 65535.0f; }
+
+// Point sets exercising the various cases of the normal computations
+static void MakePoints(ImVector<ImVec2>& points, int kind, int points_count)
+{
+    points.resize(points_count);
+    for (int n = 0; n < points_count; n++)
+    {
+        ImVec2& p = points[n];
+        switch (kind)
+        {
+        case 0: p = ImVec2(400.0f + 300.0f * ImCos(n * 0.05f), 300.0f + 200.0f * ImSin(n * 0.05f)); break;          // Smooth curve
+        case 1: p = ImVec2(RandomFloat(0.0f, 800.0f), RandomFloat(0.0f, 600.0f)); break;                               // Sharp corners
+        case 2: p = (n % 3 == 0 && n > 0) ? points[n - 1] : ImVec2((float)(n * 2), (float)((n / 3) % 2) * 5.0f); break; // Repeated points (zero length segments)
+        case 3: p = ImVec2((float)n * 0.001f, (float)(n & 1) * 0.0001f); break;                                       // Tiny segments
+        default: p = ImVec2((float)(n * 10), (n & 1) ? 0.0f : 20.0f); break;                                            // Zigzag
+        }
+    }
+}
+
+static int Errors = 0;
+
+static bool VerticesEqual(const ImDrawVert& a, const ImDrawVert& b)
+{
+    return memcmp(&a.pos, &b.pos, sizeof(a.pos)) == 0 && memcmp(&a.uv, &b.uv, sizeof(a.uv)) == 0 && a.col == b.col;
+}
+
+static void TestPolyline(ImDrawList* draw_list, const PolylineMode& mode, const ImVector<ImVec2>& points, bool closed, const char* points_desc)
+{
+    const ImU32 col = IM_COL32(255, 128, 64, 200);
+    const ImDrawFlags flags = closed ? ImDrawFlags_Closed : ImDrawFlags_None;
+    draw_list->_ResetForNewFrame();
+    draw_list->PushClipRectFullScreen();
+    draw_list->Flags = mode.Flags;
+    draw_list->AddPolyline(points.Data, points.Size, col, flags, mode.Thickness);
+    ImVector<ImDrawVert> vertices;
+    vertices.swap(draw_list->VtxBuffer);
+    const int vtx_per_point = vertices.Size / points.Size;
+
+    for (int point_n = 0; point_n < points.Size; point_n++)
+    {
+        // The first and last points of an open polyline only have one neighbor: they are always handled by the scalar code
+        if (!closed && (point_n == 0 || point_n == points.Size - 1))
+            continue;
+        const ImVec2 local_points[3] = { points[(point_n + points.Size - 1) % points.Size], points[point_n], points[(point_n + 1) % points.Size] };
+        draw_list->_ResetForNewFrame();
+        draw_list->PushClipRectFullScreen();
+        draw_list->Flags = mode.Flags;
+        draw_list->AddPolyline(local_points, 3, col, ImDrawFlags_None, mode.Thickness);
+        for (int vtx_n = 0; vtx_n < vtx_per_point; vtx_n++)
+        {
+            const ImDrawVert& v = vertices[point_n * vtx_per_point + vtx_n];
+            const ImDrawVert& expected_v = draw_list->VtxBuffer[vtx_per_point + vtx_n];
+            if (VerticesEqual(v, expected_v))
+                continue;
+            if (Errors < 20)
+                printf("FAILED: %s, %s%s, point %d vertex %d: pos (%.9g, %.9g), expected (%.9g, %.9g)\n", mode.Desc, points_desc, closed ? " (closed)" : "",
+                    point_n, vtx_n, v.pos.x, v.pos.y, expected_v.pos.x, expected_v.pos.y);
+            Errors++;
+        }
+    }
+}
+
+typedef std::chrono::high_resolution_clock Clock;
+
+int main(int argc, char** argv)
+{
+    const int iterations = (argc > 1) ? atoi(argv[1]) : 2000;
+    printf("SIMD: %s\n", SimdName);
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(800.0f, 600.0f);
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGui::NewFrame(); // Setup the shared draw list data (white pixel and lines texture coordinates)
+    ImDrawList* draw_list = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+
+    // Checks. Various sizes so the SIMD loops run with every possible scalar remainder.
+    static const char* points_desc[] = { "smooth curve", "sharp corners", "repeated points", "tiny segments", "zigzag" };
+    static const int points_counts[] = { 2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 16, 17, 100, 1001 };
+    ImVector<ImVec2> points;
+    int polylines_count = 0;
+    for (int mode_n = 0; mode_n < IM_ARRAYSIZE(Modes); mode_n++)
+        for (int kind = 0; kind < IM_ARRAYSIZE(points_desc); kind++)
+            for (int count_n = 0; count_n < IM_ARRAYSIZE(points_counts); count_n++)
+                for (int closed = 0; closed < 2; closed++)
+                {
+                    MakePoints(points, kind, points_counts[count_n]);
+                    TestPolyline(draw_list, Modes[mode_n], points, closed != 0, points_desc[kind]);
+                    polylines_count++;
+                }
+    printf("Checks: %d polyline(s), %d error(s)\n", polylines_count, Errors);
+
+    // Benchmark
+    printf("Benchmark: %d iteration(s) of a 1000 points polyline\n", iterations);
+    MakePoints(points, 0, 1000);
+    for (int mode_n = 0; mode_n < IM_ARRAYSIZE(Modes); mode_n++)
+    {
+        const PolylineMode& mode = Modes[mode_n];
+        Clock::time_point t0 = Clock::now();
+        for (int it = 0; it < iterations; it++)
+        {
+            draw_list->_ResetForNewFrame();
+            draw_list->PushClipRectFullScreen();
+            draw_list->Flags = mode.Flags;
+            draw_list->AddPolyline(points.Data, points.Size, IM_COL32_WHITE, ImDrawFlags_Closed, mode.Thickness);
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+        printf("  %-30s %8.1f M points/s\n", mode.Desc, (double)points.Size * iterations / seconds / 1e6);
+    }
+
+    IM_DELETE(draw_list);
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    printf("%s\n", Errors ? "FAILED" : "All checks passed");
+    return Errors ? 1 : 0;
+}
@@ -0,0 +1,405 @@
+// dear imgui
+// (text_conversion_test.cpp)
+// Test and benchmark for the UTF-8 <> ImWchar conversion functions (ImTextStrFromUtf8(), ImTextCountCharsFromUtf8(), ImTextStrToUtf8(),
+// ImTextCountUtf8BytesFromStr()), which process 16 characters at a time with SSE or NEON when enabled.
+// Their results are compared with scalar reference copies of those functions, on random inputs made of ASCII runs, valid 2/3/4 bytes sequences,
+// truncated sequences, overlong encodings, surrogates, out of range code points, stray continuation bytes and embedded zeros,
+// with NULL and explicit ends and random output buffer sizes. Inputs are allocated with their exact size so ASan builds catch any over-read.
+
+// Build from this folder with, e.g:
+//   # g++ -O2 -I../.. text_conversion_test.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp                               (SSE on x86)
+//   # g++ -O2 -I../.. -DIMGUI_USE_NEON text_conversion_test.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp               (NEON on AArch64)
+//   # g++ -O2 -I../.. -DIMGUI_USE_WCHAR32 text_conversion_test.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp            (32-bit ImWchar)
+//   # g++ -g -fsanitize=address -I../.. text_conversion_test.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp              (over-read checks)
+// This tool is not part of the library: don't add it to your project sources.
+
+// Usage:
+//   text_conversion_test.exe [cases] [benchmark buffer size in MB]
+// Returns 0 if all checks passed, 1 otherwise.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#if defined(IMGUI_ENABLE_SSE)
+static const char* SimdName = "SSE";
+#elif defined(IMGUI_ENABLE_NEON)
+static const char* SimdName = "NEON";
+#else
+static const char* SimdName = "none (scalar)";
+#endif
+
+//-----------------------------------------------------------------------------
+// Scalar reference: copies of the functions without SIMD code paths
+// (RefTextCharFromUtf8() has no ASCII early-out, to check it too)
+//-----------------------------------------------------------------------------
+
+static int RefTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char* in_text_end)
+{
+    static const char lengths[32] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 3, 3, 4, 0 };
+    static const int masks[]  = { 0x00, 0x7f, 0x1f, 0x0f, 0x07 };
+    static const ImU32 mins[] = { 0x400000, 0, 0x80, 0x800, 0x10000 };
+    static const int shiftc[] = { 0, 18, 12, 6, 0 };
+    static const int shifte[] = { 0, 6, 4, 2, 0 };
+    int len = lengths[*(const unsigned char*)in_text >> 3];
+    int wanted = len + !len;
+    if (in_text_end == NULL)
+    {
+        in_text_end = in_text + 1;
+        while (in_text_end < in_text + wanted && *in_text_end != 0)
+            in_text_end++;
+    }
+    unsigned char s[4];
+    s[0] = in_text + 0 < in_text_end ? in_text[0] : 0;
+    s[1] = in_text + 1 < in_text_end ? in_text[1] : 0;
+    s[2] = in_text + 2 < in_text_end ? in_text[2] : 0;
+    s[3] = in_text + 3 < in_text_end ? in_text[3] : 0;
+    *out_char  = (ImU32)(s[0] & masks[len]) << 18;
+    *out_char |= (ImU32)(s[1] & 0x3f) << 12;
+    *out_char |= (ImU32)(s[2] & 0x3f) <<  6;
+    *out_char |= (ImU32)(s[3] & 0x3f) <<  0;
+    *out_char >>= shiftc[len];
+    int e = 0;
+    e  = (*out_char < mins[len]) << 6;
+    e |= ((*out_char >> 11) == 0x1b) << 7;
+    e |= (*out_char > IM_UNICODE_CODEPOINT_MAX) << 8;
+    e |= (s[1] & 0xc0) >> 2;
+    e |= (s[2] & 0xc0) >> 4;
+    e |= (s[3]       ) >> 6;
+    e ^= 0x2a;
+    e >>= shifte[len];
+    if (e)
+    {
+        wanted = ImMin(wanted, !!s[0] + !!s[1] + !!s[2] + !!s[3]);
+        *out_char = IM_UNICODE_CODEPOINT_INVALID;
+    }
+    return wanted;
+}
+
+static int RefTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
+{
+    ImWchar* buf_out = buf;
+    ImWchar* buf_end = buf + buf_size;
+    while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
+    {
+        unsigned int c;
+        in_text += RefTextCharFromUtf8(&c, in_text, in_text_end);
+        if (c == 0)
+            break;
+        *buf_out++ = (ImWchar)c;
+    }
+    *buf_out = 0;
+    if (in_text_remaining)
+        *in_text_remaining = in_text;
+    return (int)(buf_out - buf);
+}
+
+static int RefTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
+{
+    int char_count = 0;
+    while ((!in_text_end || in_text < in_text_end) && *in_text)
+    {
+        unsigned int c;
+        in_text += RefTextCharFromUtf8(&c, in_text, in_text_end);
+        if (c == 0)
+            break;
+        char_count++;
+    }
+    return char_count;
+}
+
+static int RefTextCharToUtf8(char* buf, int buf_size, unsigned int c)
+{
+    if (c < 0x80)
+    {
+        buf[0] = (char)c;
+        return 1;
+    }
+    if (c < 0x800)
+    {
+        if (buf_size < 2) return 0;
+        buf[0] = (char)(0xc0 + (c >> 6));
+        buf[1] = (char)(0x80 + (c & 0x3f));
+        return 2;
+    }
+    if (c < 0x10000)
+    {
+        if (buf_size < 3) return 0;
+        buf[0] = (char)(0xe0 + (c >> 12));
+        buf[1] = (char)(0x80 + ((c >> 6) & 0x3f));
+        buf[2] = (char)(0x80 + ((c ) & 0x3f));
+        return 3;
+    }
+    if (c <= 0x10FFFF)
+    {
+        if (buf_size < 4) return 0;
+        buf[0] = (char)(0xf0 + (c >> 18));
+        buf[1] = (char)(0x80 + ((c >> 12) & 0x3f));
+        buf[2] = (char)(0x80 + ((c >> 6) & 0x3f));
+        buf[3] = (char)(0x80 + ((c ) & 0x3f));
+        return 4;
+    }
+    return 0;
+}
+
+static int RefTextStrToUtf8(char* out_buf, int out_buf_size, const ImWchar* in_text, const ImWchar* in_text_end)
+{
+    char* buf_p = out_buf;
+    const char* buf_end = out_buf + out_buf_size;
+    while (buf_p < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
+    {
+        unsigned int c = (unsigned int)(*in_text++);
+        if (c < 0x80)
+            *buf_p++ = (char)c;
+        else
+            buf_p += RefTextCharToUtf8(buf_p, (int)(buf_end - buf_p - 1), c);
+    }
+    *buf_p = 0;
+    return (int)(buf_p - out_buf);
+}
+
+static int RefTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end)
+{
+    int bytes_count = 0;
+    while ((!in_text_end || in_text < in_text_end) && *in_text)
+    {
+        unsigned int c = (unsigned int)(*in_text++);
+        if (c < 0x80) bytes_count++;
+        else if (c < 0x800) bytes_count += 2;
+        else if (c < 0x10000) bytes_count += 3;
+        else if (c <= 0x10FFFF) bytes_count += 4;
+        else bytes_count += 3;
+    }
+    return bytes_count;
+}
+
+//-----------------------------------------------------------------------------
+// Random inputs
+//-----------------------------------------------------------------------------
+
+static unsigned int Rng = 12345;
+static unsigned int Random(unsigned int n) { Rng ^= Rng << 13; Rng ^= Rng >> 17; Rng ^= Rng << 5; return Rng % n; }
+
+static void AppendUtf8Fragment(std::string& s)
+{
+    char buf[5];
+    switch (Random(16))
+    {
+    case 0: case 1: case 2: case 3: case 4:                                                 // ASCII run, long enough to use the SIMD code
+        for (int n = Random(48); n > 0; n--)
+            s += (char)(0x20 + Random(0x5F));
+        break;
+    case 5: case 6: s += ImTextCharToUtf8(buf, 0x80 + Random(0x800 - 0x80)); break;         // 2 bytes
+    case 7:         s += ImTextCharToUtf8(buf, 0x800 + Random(0xD800 - 0x800)); break;      // 3 bytes
+    case 8:         s += ImTextCharToUtf8(buf, 0x10000 + Random(0x110000 - 0x10000)); break;// 4 bytes
+    case 9:         { std::string seq = ImTextCharToUtf8(buf, 0x80 + Random(0x110000 - 0x80)); s += seq.substr(0, 1 + Random((unsigned int)seq.size() - 1)); break; } // Truncated (when longer than 1 byte)
+    case 10:        { static const char* overlong[] = { "\xC0\x80", "\xC1\xBF", "\xE0\x80\x80", "\xE0\x9F\xBF", "\xF0\x80\x80\x80", "\xF0\x8F\xBF\xBF" }; s += overlong[Random(IM_ARRAYSIZE(overlong))]; break; }
+    case 11:        { static const char* surrogates[] = { "\xED\xA0\x80", "\xED\xAF\xBF", "\xED\xB0\x80", "\xED\xBF\xBF" }; s += surrogates[Random(IM_ARRAYSIZE(surrogates))]; break; }
+    case 12:        { static const char* out_of_range[] = { "\xF4\x90\x80\x80", "\xF7\xBF\xBF\xBF", "\xF8\x88\x80\x80\x80", "\xFF", "\xFE" }; s += out_of_range[Random(IM_ARRAYSIZE(out_of_range))]; break; }
+    case 13:        s += (char)(0x80 + Random(0x40)); break;                                // Stray continuation byte
+    case 14:        s += '\0'; break;                                                       // Embedded zero
+    default:        s += (char)(1 + Random(0xFF)); break;                                   // Any byte
+    }
+}
+
+static ImWchar RandomWideChar()
+{
+    switch (Random(10))
+    {
+    case 0: case 1: case 2: case 3: return (ImWchar)(1 + Random(0x7F));                     // ASCII
+    case 4: case 5:                 return (ImWchar)(0x80 + Random(0x800 - 0x80));          // 2 bytes
+    case 6:                         return (ImWchar)(0x800 + Random(IM_UNICODE_CODEPOINT_MAX - 0x800 + 1)); // 3 bytes, or 4 bytes with 32-bit ImWchar
+    case 7:                         return (ImWchar)(0xD800 + Random(0x800));               // Surrogates
+#ifdef IMGUI_USE_WCHAR32
+    case 8:                         return (ImWchar)(0x110000 + Random(0x1000000));         // Out of range
+#endif
+    case 9:                         return 0;                                               // Embedded zero
+    default:                        return (ImWchar)Random(0x10000);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Checks
+//-----------------------------------------------------------------------------
+
+static int Errors = 0;
+
+static void ReportError(const char* func, int case_n, const char* desc)
+{
+    if (Errors < 20)
+        printf("FAILED: %s, case %d: %s\n", func, case_n, desc);
+    Errors++;
+}
+
+static void CheckUtf8Input(int case_n, const std::string& s)
+{
+    // Exact size copies, with and without a terminator
+    const int len = (int)s.size();
+    char* text = (char*)malloc(len + 1);
+    memcpy(text, s.data(), len);
+    text[len] = 0;
+    char* text_no_zero = (char*)malloc(len > 0 ? len : 1);
+    memcpy(text_no_zero, s.data(), len);
+
+    for (int end_n = 0; end_n < 2; end_n++)
+    {
+        const char* in_text = end_n ? text_no_zero : text;
+        const char* in_text_end = end_n ? text_no_zero + len : NULL;
+        if (ImTextCountCharsFromUtf8(in_text, in_text_end) != RefTextCountCharsFromUtf8(in_text, in_text_end))
+            ReportError("ImTextCountCharsFromUtf8()", case_n, "different count");
+
+        const int buf_size = (Random(4) == 0) ? 1 + (int)Random(len + 1) : len + 1 + (int)Random(32);
+        ImWchar* buf = (ImWchar*)malloc(buf_size * sizeof(ImWchar));
+        ImWchar* ref_buf = (ImWchar*)malloc(buf_size * sizeof(ImWchar));
+        const char* remaining = NULL;
+        const char* ref_remaining = NULL;
+        const int count = ImTextStrFromUtf8(buf, buf_size, in_text, in_text_end, &remaining);
+        const int ref_count = RefTextStrFromUtf8(ref_buf, buf_size, in_text, in_text_end, &ref_remaining);
+        if (count != ref_count)
+            ReportError("ImTextStrFromUtf8()", case_n, "different count");
+        else if (memcmp(buf, ref_buf, (count + 1) * sizeof(ImWchar)) != 0)
+            ReportError("ImTextStrFromUtf8()", case_n, "different output");
+        else if (remaining != ref_remaining)
+            ReportError("ImTextStrFromUtf8()", case_n, "different remaining text");
+        free(buf);
+        free(ref_buf);
+    }
+    free(text);
+    free(text_no_zero);
+}
+
+static void CheckWideInput(int case_n, const ImVector<ImWchar>& s)
+{
+    const int len = s.Size;
+    ImWchar* text = (ImWchar*)malloc((len + 1) * sizeof(ImWchar));
+    ImWchar* text_no_zero = (ImWchar*)malloc((len > 0 ? len : 1) * sizeof(ImWchar));
+    if (len > 0)
+    {
+        memcpy(text, s.Data, len * sizeof(ImWchar));
+        memcpy(text_no_zero, s.Data, len * sizeof(ImWchar));
+    }
+    text[len] = 0;
+
+    for (int end_n = 0; end_n < 2; end_n++)
+    {
+        const ImWchar* in_text = end_n ? text_no_zero : text;
+        const ImWchar* in_text_end = end_n ? text_no_zero + len : NULL;
+        if (ImTextCountUtf8BytesFromStr(in_text, in_text_end) != RefTextCountUtf8BytesFromStr(in_text, in_text_end))
+            ReportError("ImTextCountUtf8BytesFromStr()", case_n, "different count");
+
+        const int buf_size = (Random(4) == 0) ? 1 + (int)Random(len * 4 + 1) : len * 4 + 1 + (int)Random(32);
+        char* buf = (char*)malloc(buf_size);
+        char* ref_buf = (char*)malloc(buf_size);
+        const int count = ImTextStrToUtf8(buf, buf_size, in_text, in_text_end);
+        const int ref_count = RefTextStrToUtf8(ref_buf, buf_size, in_text, in_text_end);
+        if (count != ref_count)
+            ReportError("ImTextStrToUtf8()", case_n, "different count");
+        else if (memcmp(buf, ref_buf, count + 1) != 0)
+            ReportError("ImTextStrToUtf8()", case_n, "different output");
+        free(buf);
+        free(ref_buf);
+    }
+    free(text);
+    free(text_no_zero);
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark
+//-----------------------------------------------------------------------------
+
+typedef std::chrono::high_resolution_clock Clock;
+static volatile int Sink = 0; // Keep the results from being optimized out
+
+static double MBPerSecond(size_t bytes, Clock::time_point t0)
+{
+    return bytes / std::chrono::duration<double>(Clock::now() - t0).count() / (1024.0 * 1024.0);
+}
+
+static void Benchmark(const char* desc, const std::string& utf8)
+{
+    const int len = (int)utf8.size();
+    const int wide_len = ImTextCountCharsFromUtf8(utf8.c_str(), NULL);
+    ImVector<ImWchar> wide;
+    wide.resize(wide_len + 1);
+    ImTextStrFromUtf8(wide.Data, wide.Size, utf8.c_str(), NULL);
+    ImVector<char> utf8_out;
+    utf8_out.resize(len + 1);
+
+    // Best of a few runs of each function
+    static const char* funcs[] = { "ImTextCountCharsFromUtf8()", "ImTextStrFromUtf8()", "ImTextCountUtf8BytesFromStr()", "ImTextStrToUtf8()" };
+    double ref_speeds[4] = {}, speeds[4] = {};
+    for (int run = 0; run < 5; run++)
+    {
+        Clock::time_point t0;
+        t0 = Clock::now(); Sink = RefTextCountCharsFromUtf8(utf8.c_str(), utf8.c_str() + len); ref_speeds[0] = ImMax(ref_speeds[0], MBPerSecond(len, t0));
+        t0 = Clock::now(); Sink = ImTextCountCharsFromUtf8(utf8.c_str(), utf8.c_str() + len); speeds[0] = ImMax(speeds[0], MBPerSecond(len, t0));
+        t0 = Clock::now(); Sink = RefTextStrFromUtf8(wide.Data, wide.Size, utf8.c_str(), utf8.c_str() + len, NULL); ref_speeds[1] = ImMax(ref_speeds[1], MBPerSecond(len, t0));
+        t0 = Clock::now(); Sink = ImTextStrFromUtf8(wide.Data, wide.Size, utf8.c_str(), utf8.c_str() + len, NULL); speeds[1] = ImMax(speeds[1], MBPerSecond(len, t0));
+        t0 = Clock::now(); Sink = RefTextCountUtf8BytesFromStr(wide.Data, wide.Data + wide_len); ref_speeds[2] = ImMax(ref_speeds[2], MBPerSecond(len, t0));
+        t0 = Clock::now(); Sink = ImTextCountUtf8BytesFromStr(wide.Data, wide.Data + wide_len); speeds[2] = ImMax(speeds[2], MBPerSecond(len, t0));
+        t0 = Clock::now(); Sink = RefTextStrToUtf8(utf8_out.Data, utf8_out.Size, wide.Data, wide.Data + wide_len); ref_speeds[3] = ImMax(ref_speeds[3], MBPerSecond(len, t0));
+        t0 = Clock::now(); Sink = ImTextStrToUtf8(utf8_out.Data, utf8_out.Size, wide.Data, wide.Data + wide_len); speeds[3] = ImMax(speeds[3], MBPerSecond(len, t0));
+    }
+    printf("  %s, %.1f MB (scalar reference -> library):\n", desc, len / (1024.0 * 1024.0));
+    for (int n = 0; n < IM_ARRAYSIZE(funcs); n++)
+        printf("    %-30s %8.0f -> %8.0f MB/s\n", funcs[n], ref_speeds[n], speeds[n]);
+}
+
+int main(int argc, char** argv)
+{
+    const int cases_count = (argc > 1) ? atoi(argv[1]) : 200000;
+    const int benchmark_mb = (argc > 2) ? atoi(argv[2]) : 4;
+    printf("SIMD: %s, ImWchar: %d bits\n", SimdName, (int)sizeof(ImWchar) * 8);
+
+    for (int case_n = 0; case_n < cases_count; case_n++)
+    {
+        std::string utf8;
+        for (int n = Random(24); n > 0; n--)
+            AppendUtf8Fragment(utf8);
+        CheckUtf8Input(case_n, utf8);
+
+        ImVector<ImWchar> wide;
+        const int wide_kind = Random(3); // Mostly ASCII, mostly 2 bytes, or mixed
+        for (int n = Random(80); n > 0; n--)
+        {
+            ImWchar c = RandomWideChar();
+            if (wide_kind == 0 && Random(16) != 0)
+                c = (ImWchar)(0x20 + Random(0x5F));
+            else if (wide_kind == 1 && Random(16) != 0)
+                c = (ImWchar)(0x80 + Random(0x800 - 0x80));
+            wide.push_back(c);
+        }
+        CheckWideInput(case_n, wide);
+    }
+    printf("Checks: %d case(s), %d error(s)\n", cases_count, Errors);
+
+    // Benchmark
+    if (benchmark_mb > 0)
+    {
+        const size_t size = (size_t)benchmark_mb * 1024 * 1024;
+        static const char* cyrillic_words[] = { "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82", "\xD0\xBC\xD0\xB8\xD1\x80", "\xD0\xBE\xD0\xBA\xD0\xBD\xD0\xBE", "\xD1\x82\xD0\xB5\xD0\xBA\xD1\x81\xD1\x82" };
+        std::string ascii, latin, cyrillic, cjk;
+        char buf[5];
+        while (ascii.size() < size)
+            ascii += "The quick brown fox jumps over the lazy dog. 0123456789\n";
+        while (latin.size() < size)
+            latin += (Random(10) == 0) ? std::string(ImTextCharToUtf8(buf, 0xC0 + Random(0x40))) : std::string(1, (char)('a' + Random(26)));
+        while (cyrillic.size() < size)
+            cyrillic += std::string(cyrillic_words[Random(IM_ARRAYSIZE(cyrillic_words))]) + " ";
+        while (cjk.size() < size)
+            cjk += ImTextCharToUtf8(buf, 0x4E00 + Random(0x5000));
+        printf("Benchmark:\n");
+        Benchmark("ASCII", ascii);
+        Benchmark("Latin, 10% 2 bytes", latin);
+        Benchmark("Cyrillic words", cyrillic);
+        Benchmark("CJK", cjk);
+    }
+
+    printf("%s\n", Errors ? "FAILED" : "All checks passed");
+    return Errors ? 1 : 0;
+}
@@ -0,0 +1,83 @@
+// dear imgui
+// (text_layout_test.cpp)
+// Test for the size of long multi-line texts submitted with TextEx(), which are laid out once and kept in the text layout cache.
+// Unless ImGuiTextFlags_NoWidthForLargeClippedText is used, the item width must match CalcTextSize() over the whole text,
+// including lines which are clipped and text after "##" (which is not hidden by Text functions).
+
+// Build from this folder with, e.g:
+//   # g++ -O2 -I../.. text_layout_test.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_tables.cpp
+// This tool is not part of the library: don't add it to your project sources.
+
+// Usage:
+//   text_layout_test.exe
+// Returns 0 if all checks passed, 1 otherwise.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <string>
+
+static int TestTextWidth(const char* desc, const std::string& text, float scroll_y)
+{
+    int errors = 0;
+    float expected_w = 0.0f;
+    for (int frame = 0; frame < 3; frame++) // First frame lays out the text, next ones use the cache
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(io.DisplaySize);
+        ImGui::Begin("Test", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_HorizontalScrollbar);
+        ImGui::SetScrollY(scroll_y);
+        ImGui::TextEx(text.c_str(), text.c_str() + text.size(), ImGuiTextFlags_None);
+        const float w = ImGui::GetItemRectSize().x;
+        expected_w = ImGui::CalcTextSize(text.c_str(), text.c_str() + text.size()).x;
+        ImGui::End();
+        ImGui::Render();
+        if (w != expected_w)
+        {
+            printf("FAILED: %s, frame %d: width %.1f, expected %.1f\n", desc, frame, w, expected_w);
+            errors++;
+        }
+    }
+    if (errors == 0)
+        printf("OK: %s: width %.1f\n", desc, expected_w);
+    return errors;
+}
+
+static std::string MakeText(int lines_count, int long_line_n, const char* long_line)
+{
+    std::string text;
+    for (int line_n = 0; line_n < lines_count; line_n++)
+    {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "Line %d\n", line_n);
+        text += (line_n == long_line_n) ? std::string(long_line) + "\n" : buf;
+    }
+    return text;
+}
+
+int main(int, char**)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(800.0f, 600.0f);
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    const char* long_line = "short##and a long tail which is still part of the visible text, so it counts in the width";
+    int errors = 0;
+    errors += TestTextWidth("long line visible", MakeText(300, 5, long_line), 0.0f);
+    errors += TestTextWidth("long line clipped below", MakeText(300, 250, long_line), 0.0f);
+    errors += TestTextWidth("long line clipped above", MakeText(300, 5, long_line), 3000.0f);
+    errors += TestTextWidth("long line with ### clipped below", MakeText(300, 250, "short###and a long tail which is still part of the visible text"), 0.0f);
+    errors += TestTextWidth("no newline at end", MakeText(300, 250, long_line) + "last line without newline", 0.0f);
+    errors += TestTextWidth("empty lines", std::string(3000, '\n') + long_line, 0.0f);
+
+    ImGui::DestroyContext();
+    printf("%s\n", errors ? "FAILED" : "All tests passed");
+    return errors ? 1 : 0;
+}
@@ -46,7 +46,7 @@ void SetupImgui() {
     LOGD("no problem?");
     ImFontConfig font_cfg;
     font_cfg.SizePixels = 22.0f;
-	io.Fonts->AddFontFromMemoryTTF(Roboto_Regular, 22, 22.0f);
+	io.Fonts->AddFontFromMemoryCompressedTTF(Roboto_Regular_compressed_data, Roboto_Regular_compressed_size, 22.0f);
     //io.Fonts->AddFontDefault(&font_cfg);
     ImGui::GetStyle().ScaleAllSizes(3.0f);
 }
@@ -233,6 +233,13 @@ EGLBoolean hook_eglSwapBuffers(EGLDisplay dpy, EGLSurface surface) {
         break;
     }
 
+    // Menu is idle: draw the last frame again instead of building a new one
+    if (ImGui::CanSkipFrame()) {
+        glViewport(0, 0, (int)io.DisplaySize.x, (int)io.DisplaySize.y);
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        return old_eglSwapBuffers(dpy, surface);
+    }
+
     // Start the Dear ImGui frame
     ImGui_ImplOpenGL3_NewFrame();
     ImGui::NewFrame();
@@ -644,7 +644,7 @@ void SetupImGui()
 
         font_cfg.SizePixels = 22.0f;
 
-        io.Fonts->AddFontFromMemoryTTF(Roboto_Regular, 22, 22.0f);
+        io.Fonts->AddFontFromMemoryCompressedTTF(Roboto_Regular_compressed_data, Roboto_Regular_compressed_size, 22.0f);
 
         io.IniFilename = NULL;
         io.KeyMap[ImGuiKey_UpArrow] = 19;